@@ -0,0 +1,246 @@
+/* ============================================================================================================================ *//**
+ * @file       atomic_named_bitset.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 2:32:05 am
+ * @modified   Monday, 19th October 2026 10:49:27 pm
+ * @project    cpp-utils
+ * @brief      Definition of the atomic_named_bitset class template - lock-free counterpart of the named_bitset
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_ATOMIC_NAMED_BITSET_H__
+#define __ESTD_ATOMIC_NAMED_BITSET_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+// Private includes
+#include "estd/enum.hpp"
+#include "estd/bit.hpp"
+#include "estd/named_bitset.hpp"
+#include "estd/locks.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ===================================================== Atomic named bitset ====================================================== */
+
+/**
+ * @brief Lock-free bitset of @p N bits indexed with enum class values and backed by the array of
+ *    std::atomic<uint64_t> words. Bit @a i is stored in the (i % 64) bit of the (i / 64) word
+ * @details All single-bit operations as well as operations on masks (e.g. built with the pseudo-bitwise
+ *    enum operators) are single atomic RMW operations. Operations on the whole named_bitset are performed
+ *    word by word. For sets wider than 64 bits they are serialized with a sequence counter (kept odd for
+ *    the duration of the write) and single-word operations bump the counter after modifying the word, so
+ *    that snapshot() returns the state of the set that has actually existed at some point of time
+ * @note Whole-set operations on sets wider than 64 bits wait for each other (single-word operations
+ *    stay lock-free)
+ * @note Consistency of snapshots is guaranteed for modifications performed with (at least) release
+ *    memory ordering
+ *
+ * @tparam N
+ *    size of the bitset
+ */
+template<std::size_t N>
+class atomic_named_bitset {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the storage word
+    using word_type = uint64_t;
+
+    /// Type of the non-atomic bitset
+    using bitset_type = named_bitset<N>;
+
+public: /* --------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Number of bits in the storage word
+    static constexpr std::size_t word_bitsize = sizeof(word_type) * byte_bitsize;
+
+    /// Number of storage words
+    static constexpr std::size_t words = (N + word_bitsize - 1) / word_bitsize;
+
+    /// Indicates whether the set is lock-free on the target
+    static constexpr bool is_always_lock_free = std::atomic<word_type>::is_always_lock_free;
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Constructs the set with all bits cleared
+    constexpr atomic_named_bitset() noexcept = default;
+
+    /// Constructs the set with the initial state given by @p set
+    explicit atomic_named_bitset(const bitset_type &set) noexcept;
+
+    /// Atomic sets are not copyable
+    atomic_named_bitset(const atomic_named_bitset &) = delete;
+    atomic_named_bitset &operator=(const atomic_named_bitset &) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    value of the @p pos bit
+     */
+    bool test(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+    /**
+     * @returns
+     *    value of the bit indexed by @p field
+     */
+    template<typename Enum>
+        requires (std::is_enum_v<Enum>)
+    bool test(Enum field, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+    /**
+     * @brief Sets the @p pos bit to @p value
+     * @returns
+     *    previous value of the bit
+     */
+    bool set(std::size_t pos, bool value = true, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Sets the bit indexed by @p field to @p value
+     * @returns
+     *    previous value of the bit
+     */
+    template<typename Enum>
+        requires (std::is_enum_v<Enum>)
+    bool set(Enum field, bool value = true, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Clears the @p pos bit
+     * @returns
+     *    previous value of the bit
+     */
+    bool reset(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Clears the bit indexed by @p field
+     * @returns
+     *    previous value of the bit
+     */
+    template<typename Enum>
+        requires (std::is_enum_v<Enum>)
+    bool reset(Enum field, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Flips the @p pos bit
+     * @returns
+     *    previous value of the bit
+     */
+    bool flip(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Flips the bit indexed by @p field
+     * @returns
+     *    previous value of the bit
+     */
+    template<typename Enum>
+        requires (std::is_enum_v<Enum>)
+    bool flip(Enum field, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Atomically ORs the first 64 bits of the set with @p mask (e.g. E::a | E::b)
+     * @returns
+     *    previous value of the first 64 bits of the set
+     */
+    word_type fetch_or(word_type mask, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Atomically ANDs the first 64 bits of the set with @p mask (e.g. ~E::a)
+     * @returns
+     *    previous value of the first 64 bits of the set
+     */
+    word_type fetch_and(word_type mask, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief ORs the set with @p set (word by word)
+     * @returns
+     *    previous value of the set
+     */
+    bitset_type fetch_or(const bitset_type &set, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief ANDs the set with @p set (word by word)
+     * @returns
+     *    previous value of the set
+     */
+    bitset_type fetch_and(const bitset_type &set, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Writes @p set into the set (word by word)
+     */
+    void store(const bitset_type &set, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @brief Clears all bits of the set (word by word)
+     */
+    void clear(std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+    /**
+     * @returns
+     *    consistent copy of the set
+     */
+    bitset_type snapshot() const noexcept;
+
+    /**
+     * @returns
+     *    @c true if any bit of the set is set
+     */
+    bool any(std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+private: /* ---------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /// Returns the word of the set holding @p pos bit
+    std::atomic<word_type> &word(std::size_t pos) noexcept { return storage[pos / word_bitsize]; }
+
+    /// Returns the word of the set holding @p pos bit
+    const std::atomic<word_type> &word(std::size_t pos) const noexcept { return storage[pos / word_bitsize]; }
+
+    /// Returns the mask of @p pos bit in its word
+    static constexpr word_type mask(std::size_t pos) noexcept { return word_type(1) << (pos % word_bitsize); }
+
+    /// Marks the single-word modification of the set (multi-word sets only)
+    void modified() noexcept;
+
+    /// Begins the multi-word modification of the set making the counter odd (multi-word sets only)
+    void begin_write() noexcept;
+
+    /// Ends the multi-word modification of the set making the counter even (multi-word sets only)
+    void end_write() noexcept;
+
+    /// Returns the @p i word of the @p set
+    static word_type to_word(const bitset_type &set, std::size_t i) noexcept;
+
+    /// Builds the bitset from the @p values words
+    static bitset_type from_words(const std::array<word_type, words> &values) noexcept;
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Storage words
+    std::array<std::atomic<word_type>, words> storage { };
+
+    /// Modifications counter used to validate snapshots of multi-word sets (odd while the set is written word by word)
+    std::conditional_t<(words > 1), std::atomic<uint64_t>, std::integral_constant<uint64_t, 0>> version { };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/bit/atomic_named_bitset.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Monday, 13th June 2022 1:18:14 am
- * @modified   Tuesday, 28th February 2023 12:19:24 am
+ * @modified   Monday, 19th October 2026 12:21:40 am
  * @project    cpp-utils
  * @brief      Definitions of common utilities for handling bit-aligned data
  * 
@@ -34,6 +34,9 @@ inline constexpr std::size_t halfword_bitsize = 16;
 /// Number of bits in a word
 inline constexpr std::size_t word_bitsize = 32;
 
+/// Number of bits in a doubleword
+inline constexpr std::size_t doubleword_bitsize = 64;
+
 /* =========================================================== Functions ========================================================== */
 
 /**
@@ -61,11 +64,15 @@ static inline void copy_bytes(const uint8_t *src, uint8_t *dst, std::size_t n);
 
 /**
  * @brief Copies @p n bytes from @p src to @p dst given the @p bitoffset of data in @p src
+ * @note Large buffers are processed with AVX2 (if enabled at compile time) and 64-bit word kernels
+ *    falling back to the byte-wise loop for the unaligned tail
  */
 static void copy_bytes_from_bitshifted(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t bitoffset);
 
 /**
  * @brief Copies @p n bytes from @p src to @p dst with the required @p bitoffset of data in @p dst
+ * @note Large buffers are processed with AVX2 (if enabled at compile time) and 64-bit word kernels
+ *    falling back to the byte-wise loop for the unaligned tail
  */
 static void copy_bytes_to_bitshifted(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t bitoffset);
 
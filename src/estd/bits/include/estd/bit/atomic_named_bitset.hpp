@@ -0,0 +1,309 @@
+/* ============================================================================================================================ *//**
+ * @file       atomic_named_bitset.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 2:32:05 am
+ * @modified   Monday, 19th October 2026 10:49:27 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the atomic_named_bitset class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_BIT_ATOMIC_NAMED_BITSET_H__
+#define __ESTD_BIT_ATOMIC_NAMED_BITSET_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include "estd/atomic_named_bitset.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================= Public ctors ========================================================= */
+
+template<std::size_t N>
+atomic_named_bitset<N>::atomic_named_bitset(const bitset_type &set) noexcept {
+    for(std::size_t i = 0; i < words; ++i)
+        storage[i].store(to_word(set, i), std::memory_order_relaxed);
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<std::size_t N>
+bool atomic_named_bitset<N>::test(std::size_t pos, std::memory_order order) const noexcept {
+    return (word(pos).load(order) & mask(pos)) != 0;
+}
+
+
+template<std::size_t N>
+template<typename Enum>
+    requires (std::is_enum_v<Enum>)
+bool atomic_named_bitset<N>::test(Enum field, std::memory_order order) const noexcept {
+    return test(static_cast<std::size_t>(estd::to_underlying(field)), order);
+}
+
+
+template<std::size_t N>
+bool atomic_named_bitset<N>::set(std::size_t pos, bool value, std::memory_order order) noexcept {
+
+    word_type previous;
+
+    if(value)
+        previous = word(pos).fetch_or(mask(pos), order);
+    else
+        previous = word(pos).fetch_and(~mask(pos), order);
+
+    modified();
+
+    return (previous & mask(pos)) != 0;
+}
+
+
+template<std::size_t N>
+template<typename Enum>
+    requires (std::is_enum_v<Enum>)
+bool atomic_named_bitset<N>::set(Enum field, bool value, std::memory_order order) noexcept {
+    return set(static_cast<std::size_t>(estd::to_underlying(field)), value, order);
+}
+
+
+template<std::size_t N>
+bool atomic_named_bitset<N>::reset(std::size_t pos, std::memory_order order) noexcept {
+    return set(pos, false, order);
+}
+
+
+template<std::size_t N>
+template<typename Enum>
+    requires (std::is_enum_v<Enum>)
+bool atomic_named_bitset<N>::reset(Enum field, std::memory_order order) noexcept {
+    return set(static_cast<std::size_t>(estd::to_underlying(field)), false, order);
+}
+
+
+template<std::size_t N>
+bool atomic_named_bitset<N>::flip(std::size_t pos, std::memory_order order) noexcept {
+
+    word_type previous = word(pos).fetch_xor(mask(pos), order);
+
+    modified();
+
+    return (previous & mask(pos)) != 0;
+}
+
+
+template<std::size_t N>
+template<typename Enum>
+    requires (std::is_enum_v<Enum>)
+bool atomic_named_bitset<N>::flip(Enum field, std::memory_order order) noexcept {
+    return flip(static_cast<std::size_t>(estd::to_underlying(field)), order);
+}
+
+
+template<std::size_t N>
+typename atomic_named_bitset<N>::word_type atomic_named_bitset<N>::fetch_or(word_type mask, std::memory_order order) noexcept {
+
+    // Do not let the mask set bits past the size of the set
+    if constexpr (N < word_bitsize)
+        mask &= (word_type(1) << N) - 1;
+
+    word_type previous = storage[0].fetch_or(mask, order);
+
+    modified();
+
+    return previous;
+}
+
+
+template<std::size_t N>
+typename atomic_named_bitset<N>::word_type atomic_named_bitset<N>::fetch_and(word_type mask, std::memory_order order) noexcept {
+
+    word_type previous = storage[0].fetch_and(mask, order);
+
+    modified();
+
+    return previous;
+}
+
+
+template<std::size_t N>
+typename atomic_named_bitset<N>::bitset_type atomic_named_bitset<N>::fetch_or(const bitset_type &set, std::memory_order order) noexcept {
+
+    std::array<word_type, words> previous;
+
+    begin_write();
+
+    for(std::size_t i = 0; i < words; ++i)
+        previous[i] = storage[i].fetch_or(to_word(set, i), order);
+
+    end_write();
+
+    return from_words(previous);
+}
+
+
+template<std::size_t N>
+typename atomic_named_bitset<N>::bitset_type atomic_named_bitset<N>::fetch_and(const bitset_type &set, std::memory_order order) noexcept {
+
+    std::array<word_type, words> previous;
+
+    begin_write();
+
+    for(std::size_t i = 0; i < words; ++i)
+        previous[i] = storage[i].fetch_and(to_word(set, i), order);
+
+    end_write();
+
+    return from_words(previous);
+}
+
+
+template<std::size_t N>
+void atomic_named_bitset<N>::store(const bitset_type &set, std::memory_order order) noexcept {
+
+    begin_write();
+
+    for(std::size_t i = 0; i < words; ++i)
+        storage[i].store(to_word(set, i), order);
+
+    end_write();
+}
+
+
+template<std::size_t N>
+void atomic_named_bitset<N>::clear(std::memory_order order) noexcept {
+
+    begin_write();
+
+    for(std::size_t i = 0; i < words; ++i)
+        storage[i].store(0, order);
+
+    end_write();
+}
+
+
+template<std::size_t N>
+typename atomic_named_bitset<N>::bitset_type atomic_named_bitset<N>::snapshot() const noexcept {
+
+    std::array<word_type, words> values;
+
+    // Single word is always consistent
+    if constexpr (words <= 1) {
+
+        for(std::size_t i = 0; i < words; ++i)
+            values[i] = storage[i].load(std::memory_order_acquire);
+
+    /**
+     * @note Multi-word writers keep the counter odd while modifying words and single-word writers bump it
+     *    (by 2) after their modification. The copy is valid if the counter was even and did not change
+     *    while words were read
+     */
+    } else {
+
+        spin_backoff backoff;
+
+        for(;; backoff()) {
+
+            uint64_t before = version.load(std::memory_order_acquire);
+
+            // Multi-word modification in progress
+            if(before & 1)
+                continue;
+
+            for(std::size_t i = 0; i < words; ++i)
+                values[i] = storage[i].load(std::memory_order_acquire);
+
+            if(version.load(std::memory_order_acquire) == before)
+                break;
+        }
+    }
+
+    return from_words(values);
+}
+
+
+template<std::size_t N>
+bool atomic_named_bitset<N>::any(std::memory_order order) const noexcept {
+
+    for(std::size_t i = 0; i < words; ++i) {
+        if(storage[i].load(order) != 0)
+            return true;
+    }
+
+    return false;
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+template<std::size_t N>
+void atomic_named_bitset<N>::modified() noexcept {
+    // Keep parity of the counter, so that the pending multi-word write is still visible to readers
+    if constexpr (words > 1)
+        version.fetch_add(2, std::memory_order_acq_rel);
+}
+
+
+template<std::size_t N>
+void atomic_named_bitset<N>::begin_write() noexcept {
+    if constexpr (words > 1) {
+
+        spin_backoff backoff;
+
+        for(uint64_t current = version.load(std::memory_order_relaxed);; backoff()) {
+
+            // Wait for other multi-word writers to finish
+            if(current & 1) {
+                current = version.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if(version.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                break;
+        }
+
+        // Orders the odd counter before modifications of words (pairs with acquire loads in snapshot())
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+}
+
+
+template<std::size_t N>
+void atomic_named_bitset<N>::end_write() noexcept {
+    // Single-word writers may have bumped the counter in the meantime, so it cannot be simply stored
+    if constexpr (words > 1)
+        version.fetch_add(1, std::memory_order_release);
+}
+
+
+template<std::size_t N>
+typename atomic_named_bitset<N>::word_type atomic_named_bitset<N>::to_word(const bitset_type &set, std::size_t i) noexcept {
+
+    if constexpr (N <= word_bitsize)
+        return static_cast<word_type>(set.to_ullong());
+    else
+        return static_cast<word_type>(((set >> (i * word_bitsize)) & std::bitset<N>{ ~word_type(0) }).to_ullong());
+}
+
+
+template<std::size_t N>
+typename atomic_named_bitset<N>::bitset_type atomic_named_bitset<N>::from_words(const std::array<word_type, words> &values) noexcept {
+
+    std::bitset<N> set;
+
+    for(std::size_t i = words; i > 0; --i) {
+        if constexpr (N > word_bitsize)
+            set <<= word_bitsize;
+        set |= std::bitset<N>{ values[i - 1] };
+    }
+
+    return bitset_type{ set };
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Monday, 13th June 2022 1:19:55 am
- * @modified   Tuesday, 28th February 2023 8:40:50 pm
+ * @modified   Sunday, 18th October 2026 11:48:02 pm
  * @project    cpp-utils
  * @brief      Definitions of common utilities for handling bit-aligned data
  * 
@@ -18,6 +18,12 @@
 
 // Standard includes
 #include <algorithm>
+#include <bit>
+#include <cstring>
+// Intrinsics
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 // Private includes
 #include "estd/bit.hpp"
 
@@ -25,6 +31,194 @@
 
 namespace estd {
 
+/* ============================================================ Kernels =========================================================== */
+
+namespace details {
+
+    /**
+     * @brief Byte-wise kernel computing dst[i] = (src[i] >> shift) | (src[i + 1] << (8 - shift)) for i in [0, n)
+     * @note Reads @p n + 1 bytes of @p src ; @p shift must be in range [1, 7]
+     * @returns 
+     *    number of processed bytes (always @p n )
+     */
+    inline std::size_t shift_bytes_right_bytewise(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t shift) {
+        
+        for(std::size_t i = 0; i < n; ++i)
+            dst[i] = ((src[i + 1] << (byte_bitsize - shift)) | (src[i] >> shift));
+
+        return n;
+    }
+
+    /**
+     * @brief Byte-wise kernel computing dst[i] = (src[i] << shift) | (src[i - 1] >> (8 - shift)) for i in [0, n)
+     * @note Reads @p n + 1 bytes of @p src starting at src[-1] ; @p shift must be in range [1, 7]
+     * @returns 
+     *    number of processed bytes (always @p n )
+     */
+    inline std::size_t shift_bytes_left_bytewise(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t shift) {
+        
+        for(std::size_t i = 0; i < n; ++i)
+            dst[i] = ((src[i] << shift) | (src[i - 1] >> (byte_bitsize - shift)));
+
+        return n;
+    }
+
+    /**
+     * @brief Word-at-a-time version of the @ref shift_bytes_right_bytewise(). Processes 8 bytes per iteration
+     *    using unaligned 64-bit loads and stores
+     * @note Kernel is supported on little-endian targets only (on other targets it processes no data)
+     * @returns 
+     *    number of processed bytes (multiple of 8 bytes)
+     */
+    inline std::size_t shift_bytes_right_words(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t shift) {
+
+        if constexpr (std::endian::native != std::endian::little)
+            return 0;
+
+        std::size_t i = 0;
+
+        for(; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t)) {
+
+            uint64_t word;
+            std::memcpy(&word, src + i, sizeof(word));
+
+            // Shift the word and fill it's MSBits with LSBits of the next byte
+            word = (word >> shift) | (uint64_t(src[i + sizeof(uint64_t)]) << (sizeof(uint64_t) * byte_bitsize - shift));
+
+            std::memcpy(dst + i, &word, sizeof(word));
+        }
+
+        return i;
+    }
+
+    /**
+     * @brief Word-at-a-time version of the @ref shift_bytes_left_bytewise(). Processes 8 bytes per iteration
+     *    using unaligned 64-bit loads and stores
+     * @note Kernel is supported on little-endian targets only (on other targets it processes no data)
+     * @returns 
+     *    number of processed bytes (multiple of 8 bytes)
+     */
+    inline std::size_t shift_bytes_left_words(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t shift) {
+
+        if constexpr (std::endian::native != std::endian::little)
+            return 0;
+
+        std::size_t i = 0;
+
+        for(; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t)) {
+
+            uint64_t word;
+            std::memcpy(&word, src + i, sizeof(word));
+
+            // Shift the word and fill it's LSBits with MSBits of the previous byte
+            word = (word << shift) | (uint64_t(src[i - 1]) >> (byte_bitsize - shift));
+
+            std::memcpy(dst + i, &word, sizeof(word));
+        }
+
+        return i;
+    }
+
+#if defined(__AVX2__)
+
+    /**
+     * @brief AVX2 version of the @ref shift_bytes_right_bytewise(). Processes 32 bytes per iteration
+     * @returns 
+     *    number of processed bytes (multiple of 32 bytes)
+     */
+    inline std::size_t shift_bytes_right_simd(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t shift) {
+
+        constexpr std::size_t block_size = sizeof(__m256i);
+
+        // AVX2 does not provide byte-granular shifts; shift 16-bit lanes and mask bits moved across bytes boundaries
+        const __m128i rshift  = _mm_cvtsi64_si128(static_cast<long long>(shift));
+        const __m128i lshift  = _mm_cvtsi64_si128(static_cast<long long>(byte_bitsize - shift));
+        const __m256i rmask   = _mm256_set1_epi8(static_cast<char>(0xFFU >> shift));
+        const __m256i lmask   = _mm256_set1_epi8(static_cast<char>(0xFFU << (byte_bitsize - shift)));
+
+        std::size_t i = 0;
+
+        for(; i + block_size <= n; i += block_size) {
+
+            __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            __m256i next    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 1));
+
+            __m256i result = _mm256_or_si256(
+                _mm256_and_si256(_mm256_srl_epi16(current, rshift), rmask),
+                _mm256_and_si256(_mm256_sll_epi16(next,    lshift), lmask)
+            );
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+        }
+
+        return i;
+    }
+
+    /**
+     * @brief AVX2 version of the @ref shift_bytes_left_bytewise(). Processes 32 bytes per iteration
+     * @returns 
+     *    number of processed bytes (multiple of 32 bytes)
+     */
+    inline std::size_t shift_bytes_left_simd(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t shift) {
+
+        constexpr std::size_t block_size = sizeof(__m256i);
+
+        // AVX2 does not provide byte-granular shifts; shift 16-bit lanes and mask bits moved across bytes boundaries
+        const __m128i lshift  = _mm_cvtsi64_si128(static_cast<long long>(shift));
+        const __m128i rshift  = _mm_cvtsi64_si128(static_cast<long long>(byte_bitsize - shift));
+        const __m256i lmask   = _mm256_set1_epi8(static_cast<char>(0xFFU << shift));
+        const __m256i rmask   = _mm256_set1_epi8(static_cast<char>(0xFFU >> (byte_bitsize - shift)));
+
+        std::size_t i = 0;
+
+        for(; i + block_size <= n; i += block_size) {
+
+            __m256i current  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i - 1));
+
+            __m256i result = _mm256_or_si256(
+                _mm256_and_si256(_mm256_sll_epi16(current,  lshift), lmask),
+                _mm256_and_si256(_mm256_srl_epi16(previous, rshift), rmask)
+            );
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+        }
+
+        return i;
+    }
+
+#else
+
+    /// Stub of the SIMD kernel for targets not supporting AVX2 (processes no data)
+    inline std::size_t shift_bytes_right_simd(const uint8_t *, uint8_t *, std::size_t, std::size_t) { return 0; }
+
+    /// Stub of the SIMD kernel for targets not supporting AVX2 (processes no data)
+    inline std::size_t shift_bytes_left_simd(const uint8_t *, uint8_t *, std::size_t, std::size_t) { return 0; }
+
+#endif
+
+    /**
+     * @brief Computes dst[i] = (src[i] >> shift) | (src[i + 1] << (8 - shift)) for i in [0, n) using 
+     *    the widest kernel available for the large blocks and byte-wise kernel for the tail
+     */
+    inline void shift_bytes_right(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t shift) {
+        std::size_t i = shift_bytes_right_simd(src, dst, n, shift);
+        i += shift_bytes_right_words(src + i, dst + i, n - i, shift);
+        shift_bytes_right_bytewise(src + i, dst + i, n - i, shift);
+    }
+
+    /**
+     * @brief Computes dst[i] = (src[i] << shift) | (src[i - 1] >> (8 - shift)) for i in [0, n) using 
+     *    the widest kernel available for the large blocks and byte-wise kernel for the tail
+     */
+    inline void shift_bytes_left(const uint8_t *src, uint8_t *dst, std::size_t n, std::size_t shift) {
+        std::size_t i = shift_bytes_left_simd(src, dst, n, shift);
+        i += shift_bytes_left_words(src + i, dst + i, n - i, shift);
+        shift_bytes_left_bytewise(src + i, dst + i, n - i, shift);
+    }
+
+}
+
 /* ======================================================== Free functions ======================================================== */
 
 template<typename ValueT>
@@ -64,14 +258,8 @@ void copy_bytes_from_bitshifted(const uint8_t *src, uint8_t *dst, std::size_t n,
     if(bitoffset_remainder == 0)
         return copy_bytes(src, dst, n);
 
-    // Compute distance from the LSBit (of the source byte) to the bitoffset boundary
-    std::size_t lsb_bitoffset = bitoffset_remainder;
-    // Compute distance from the MSBit (of the source byte) to the bitoffset boundary
-    std::size_t msb_bitoffset = (byte_bitsize - bitoffset_remainder);
-
     // Copy data to the output buffer
-    for(std::size_t i = 0; i < n; ++i)
-        dst[i] = ((src[i + 1] << msb_bitoffset) | (src[i] >> lsb_bitoffset));
+    details::shift_bytes_right(src, dst, n, bitoffset_remainder);
 }
 
 
@@ -88,6 +276,9 @@ void copy_bytes_to_bitshifted(const uint8_t *src, uint8_t *dst, std::size_t n, s
     // If bitoffset does not cross byte boundary, copy raw bytes
     if(bitoffset_remainder == 0)
         return copy_bytes(src, dst, n);
+    // If there is nothing to copy, return
+    if(n == 0)
+        return;
 
     // Compute distance from the LSBit (of the destination byte) to the bitoffset boundary
     std::size_t lsb_bitoffset = bitoffset_remainder;
@@ -98,11 +289,10 @@ void copy_bytes_to_bitshifted(const uint8_t *src, uint8_t *dst, std::size_t n, s
     dst[0] = ((src[0] << lsb_bitoffset) | (dst[0] & (0xFFU >> msb_bitoffset)));
 
     // Copy data to all (n-1) 'full' bytes of the destination (i.e. bytes that will hold 8 bits from the source buffer each)
-    for(std::size_t i = 0; i < n - 1; ++i)
-        dst[i + 1] = (src[i + 1] << lsb_bitoffset) | (src[i] >> msb_bitoffset);
+    details::shift_bytes_left(src + 1, dst + 1, n - 1, lsb_bitoffset);
 
     // Handle the last element of the output manually preserving [8 - bitoffset_remainder] MSBits
-    dst[n - 1] = ((dst[n - 1] & (0xFFU << lsb_bitoffset)) | (src[n - 1] >> msb_bitoffset));
+    dst[n] = ((dst[n] & (0xFFU << lsb_bitoffset)) | (src[n - 1] >> msb_bitoffset));
 }
 
 
@@ -0,0 +1,541 @@
+/* ============================================================================================================================ *//**
+ * @file       bit_stream.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 12:21:40 am
+ * @modified   Monday, 19th October 2026 12:21:40 am
+ * @project    cpp-utils
+ * @brief      Implementation of bitstream reader/writer classes and compile-time description of bit-packed frames
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_BIT_BIT_STREAM_H__
+#define __ESTD_BIT_BIT_STREAM_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <bit>
+#include <cstring>
+// Private includes
+#include "estd/bit_stream.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace details {
+
+    /// Returns mask of @p nbits ( @p nbits < 64 ) LSBits
+    constexpr uint64_t lsbits_mask(std::size_t nbits) noexcept {
+        return (uint64_t(1) << nbits) - 1;
+    }
+
+    /**
+     * @brief Loads unaligned 64-bit word from @p src so that the first byte of the stream lands in the
+     *    LSByte (for lsb_first order) or in the MSByte (for msb_first order) of the result
+     */
+    template<bit_order Order>
+    inline uint64_t load_stream_word(const uint8_t *src) noexcept {
+
+        uint64_t word;
+        std::memcpy(&word, src, sizeof(word));
+
+        if constexpr ((Order == bit_order::lsb_first) != (std::endian::native == std::endian::little))
+            word = __builtin_bswap64(word);
+
+        return word;
+    }
+
+    /**
+     * @brief Stores @p word as unaligned 64-bit word at @p dst so that the LSByte (for lsb_first order)
+     *    or the MSByte (for msb_first order) of the word lands in the first byte of the stream
+     */
+    template<bit_order Order>
+    inline void store_stream_word(uint8_t *dst, uint64_t word) noexcept {
+
+        if constexpr ((Order == bit_order::lsb_first) != (std::endian::native == std::endian::little))
+            word = __builtin_bswap64(word);
+
+        std::memcpy(dst, &word, sizeof(word));
+    }
+
+}
+
+/* ========================================================== Bit reader ========================================================== */
+
+template<bit_order Order>
+constexpr bit_reader<Order>::bit_reader(const uint8_t *data, std::size_t size) noexcept :
+    begin{ data },
+    next{ data },
+    end{ data + size }
+{ }
+
+
+template<bit_order Order>
+template<std::size_t N>
+    requires (N <= doubleword_bitsize)
+constexpr uint64_t bit_reader<Order>::read() noexcept {
+
+    // Fields wider than the guaranteed refill size are read in two parts
+    if constexpr (N > doubleword_bitsize - byte_bitsize) {
+
+        if constexpr (Order == bit_order::lsb_first) {
+            uint64_t low = read<word_bitsize>();
+            return low | (read<N - word_bitsize>() << word_bitsize);
+        } else {
+            uint64_t high = read<N - word_bitsize>();
+            return (high << word_bitsize) | read<word_bitsize>();
+        }
+
+    } else {
+
+        if(count < N)
+            refill();
+
+        return consume(N);
+    }
+}
+
+
+template<bit_order Order>
+constexpr uint64_t bit_reader<Order>::read(std::size_t nbits) noexcept {
+
+    // Fields wider than the guaranteed refill size are read in two parts
+    if(nbits > doubleword_bitsize - byte_bitsize) {
+
+        if constexpr (Order == bit_order::lsb_first) {
+            uint64_t low = read(word_bitsize);
+            return low | (read(nbits - word_bitsize) << word_bitsize);
+        } else {
+            uint64_t high = read(nbits - word_bitsize);
+            return (high << word_bitsize) | read(word_bitsize);
+        }
+    }
+
+    if(count < nbits)
+        refill();
+
+    return consume(nbits);
+}
+
+
+template<bit_order Order>
+template<std::size_t N>
+    requires (N <= doubleword_bitsize - byte_bitsize)
+constexpr uint64_t bit_reader<Order>::peek() noexcept {
+
+    if(count < N)
+        refill();
+
+    if constexpr (N == 0)
+        return 0;
+    else if constexpr (Order == bit_order::lsb_first)
+        return acc & details::lsbits_mask(N);
+    else
+        return acc >> (doubleword_bitsize - N);
+}
+
+
+template<bit_order Order>
+constexpr void bit_reader<Order>::skip(std::size_t nbits) noexcept {
+
+    // Skip bits held by the accumulator
+    if(nbits <= count) {
+        consume(nbits);
+        return;
+    }
+
+    nbits -= count;
+    acc    = 0;
+    count  = 0;
+
+    // Skip whole bytes without loading them
+    std::size_t bytes     = nbits / byte_bitsize;
+    std::size_t available = static_cast<std::size_t>(end - next);
+
+    if(bytes <= available)
+        next += bytes;
+    else {
+        padding += bytes - available;
+        next     = end;
+    }
+
+    read(nbits % byte_bitsize);
+}
+
+
+template<bit_order Order>
+constexpr void bit_reader<Order>::align() noexcept {
+    /**
+     * @note Accumulator is always refilled with whole bytes, so number of bits consumed
+     *    from the current byte is complementary to the number of bits left in the accumulator
+     */
+    consume(count % byte_bitsize);
+}
+
+
+template<bit_order Order>
+constexpr std::size_t bit_reader<Order>::position() const noexcept {
+    return (static_cast<std::size_t>(next - begin) + padding) * byte_bitsize - count;
+}
+
+
+template<bit_order Order>
+constexpr std::size_t bit_reader<Order>::bits_left() const noexcept {
+
+    std::size_t total = static_cast<std::size_t>(end - begin) * byte_bitsize;
+    std::size_t pos   = position();
+
+    return (pos < total) ? (total - pos) : 0;
+}
+
+
+template<bit_order Order>
+constexpr bool bit_reader<Order>::overrun() const noexcept {
+    return position() > static_cast<std::size_t>(end - begin) * byte_bitsize;
+}
+
+
+template<bit_order Order>
+constexpr void bit_reader<Order>::refill() noexcept {
+
+    /**
+     * @note Fast path loads the whole word and accepts only those bytes that fit into the accumulator as
+     *    a whole. Remaining bits of the word are left in the accumulator above the @a count bit. They are
+     *    OR-ed with the very same data on the next refill, so there is no need to mask them out
+     */
+    if(not std::is_constant_evaluated() and static_cast<std::size_t>(end - next) >= sizeof(uint64_t)) {
+
+        uint64_t word = details::load_stream_word<Order>(next);
+
+        if constexpr (Order == bit_order::lsb_first)
+            acc |= (word << count);
+        else
+            acc |= (word >> count);
+
+        std::size_t bytes = (doubleword_bitsize - 1 - count) / byte_bitsize;
+
+        next  += bytes;
+        count += bytes * byte_bitsize;
+
+    // Slow path (tail of the stream)
+    } else {
+
+        while(count <= doubleword_bitsize - byte_bitsize) {
+
+            uint64_t byte = 0;
+
+            if(next != end)
+                byte = *next++;
+            else
+                ++padding;
+
+            if constexpr (Order == bit_order::lsb_first)
+                acc |= (byte << count);
+            else
+                acc |= (byte << (doubleword_bitsize - byte_bitsize - count));
+
+            count += byte_bitsize;
+        }
+
+    }
+}
+
+
+template<bit_order Order>
+constexpr uint64_t bit_reader<Order>::consume(std::size_t nbits) noexcept {
+
+    uint64_t value;
+
+    if constexpr (Order == bit_order::lsb_first) {
+
+        value   = acc & details::lsbits_mask(nbits);
+        acc   >>= nbits;
+
+    } else {
+
+        if(nbits == 0)
+            return 0;
+
+        value   = acc >> (doubleword_bitsize - nbits);
+        acc   <<= nbits;
+    }
+
+    count -= nbits;
+
+    return value;
+}
+
+/* ========================================================== Bit writer ========================================================== */
+
+template<bit_order Order>
+constexpr bit_writer<Order>::bit_writer(uint8_t *data, std::size_t size) noexcept :
+    begin{ data },
+    next{ data },
+    end{ data + size }
+{ }
+
+
+template<bit_order Order>
+template<std::size_t N>
+    requires (N <= doubleword_bitsize)
+constexpr void bit_writer<Order>::write(uint64_t value) noexcept {
+
+    // Fields wider than the guaranteed drain size are written in two parts
+    if constexpr (N > doubleword_bitsize - byte_bitsize) {
+
+        if constexpr (Order == bit_order::lsb_first) {
+            write<word_bitsize>(value);
+            write<N - word_bitsize>(value >> word_bitsize);
+        } else {
+            write<N - word_bitsize>(value >> word_bitsize);
+            write<word_bitsize>(value);
+        }
+
+    } else if constexpr (N != 0) {
+
+        if(count + N >= doubleword_bitsize)
+            drain();
+
+        append(value, N);
+    }
+}
+
+
+template<bit_order Order>
+constexpr void bit_writer<Order>::write(uint64_t value, std::size_t nbits) noexcept {
+
+    // Fields wider than the guaranteed drain size are written in two parts
+    if(nbits > doubleword_bitsize - byte_bitsize) {
+
+        if constexpr (Order == bit_order::lsb_first) {
+            write(value, word_bitsize);
+            write(value >> word_bitsize, nbits - word_bitsize);
+        } else {
+            write(value >> word_bitsize, nbits - word_bitsize);
+            write(value, word_bitsize);
+        }
+
+        return;
+    }
+
+    if(nbits == 0)
+        return;
+
+    if(count + nbits >= doubleword_bitsize)
+        drain();
+
+    append(value, nbits);
+}
+
+
+template<bit_order Order>
+constexpr void bit_writer<Order>::align() noexcept {
+    write(0, (byte_bitsize - count % byte_bitsize) % byte_bitsize);
+}
+
+
+template<bit_order Order>
+constexpr std::size_t bit_writer<Order>::flush() noexcept {
+
+    drain();
+
+    // Store the trailing, incomplete byte (it is not consumed from the accumulator)
+    if(count > 0 and next != end) {
+        if constexpr (Order == bit_order::lsb_first)
+            *next = static_cast<uint8_t>(acc);
+        else
+            *next = static_cast<uint8_t>(acc >> (doubleword_bitsize - byte_bitsize));
+    }
+
+    std::size_t written = static_cast<std::size_t>(next - begin) + ((count > 0) ? 1 : 0);
+
+    return std::min(written, static_cast<std::size_t>(end - begin));
+}
+
+
+template<bit_order Order>
+constexpr std::size_t bit_writer<Order>::position() const noexcept {
+    return (static_cast<std::size_t>(next - begin) + discarded) * byte_bitsize + count;
+}
+
+
+template<bit_order Order>
+constexpr bool bit_writer<Order>::overrun() const noexcept {
+    return position() > static_cast<std::size_t>(end - begin) * byte_bitsize;
+}
+
+
+template<bit_order Order>
+constexpr void bit_writer<Order>::drain() noexcept {
+
+    std::size_t bytes = count / byte_bitsize;
+
+    /**
+     * @note Fast path stores the whole word. Bytes of the word past the full bytes of the accumulator are
+     *    overwritten on subsequent drains/flush
+     */
+    if(not std::is_constant_evaluated() and static_cast<std::size_t>(end - next) >= sizeof(uint64_t)) {
+
+        details::store_stream_word<Order>(next, acc);
+        next += bytes;
+
+    // Slow path (tail of the buffer)
+    } else {
+
+        for(std::size_t i = 0; i < bytes; ++i) {
+
+            uint8_t byte;
+
+            if constexpr (Order == bit_order::lsb_first)
+                byte = static_cast<uint8_t>(acc >> (i * byte_bitsize));
+            else
+                byte = static_cast<uint8_t>(acc >> (doubleword_bitsize - byte_bitsize - i * byte_bitsize));
+
+            if(next != end)
+                *next++ = byte;
+            else
+                ++discarded;
+        }
+    }
+
+    // Accumulator holds at most 63 bits, so at most 7 bytes are drained
+    if constexpr (Order == bit_order::lsb_first)
+        acc >>= (bytes * byte_bitsize);
+    else
+        acc <<= (bytes * byte_bitsize);
+
+    count -= bytes * byte_bitsize;
+}
+
+
+template<bit_order Order>
+constexpr void bit_writer<Order>::append(uint64_t value, std::size_t nbits) noexcept {
+
+    value &= details::lsbits_mask(nbits);
+
+    if constexpr (Order == bit_order::lsb_first)
+        acc |= (value << count);
+    else
+        acc |= (value << (doubleword_bitsize - count - nbits));
+
+    count += nbits;
+}
+
+/* ========================================================= Frame layout ========================================================= */
+
+namespace details {
+
+    template<typename T, std::size_t Bits>
+    struct bit_field_values<bit_field<T, Bits>> {
+        using type = std::tuple<T>;
+    };
+
+    template<std::size_t Bits>
+    struct bit_field_values<bit_padding<Bits>> {
+        using type = std::tuple<>;
+    };
+
+    /// Helper trait checking whether @p Field is a specialization of the bit_padding
+    template<typename Field>
+    struct is_bit_padding : std::false_type { };
+
+    template<std::size_t Bits>
+    struct is_bit_padding<bit_padding<Bits>> : std::true_type { };
+
+    /// Converts raw bits of the field into the value of type @p T
+    template<typename T, std::size_t Bits>
+    constexpr T bits_to_value(uint64_t raw) noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            return raw != 0;
+        } else if constexpr (std::is_enum_v<T>) {
+            return static_cast<T>(bits_to_value<std::underlying_type_t<T>, Bits>(raw));
+        } else if constexpr (std::is_signed_v<T> and (Bits < doubleword_bitsize)) {
+            constexpr std::size_t shift = doubleword_bitsize - Bits;
+            return static_cast<T>(static_cast<int64_t>(raw << shift) >> shift);
+        } else {
+            return static_cast<T>(raw);
+        }
+    }
+
+    /// Converts value of the field into raw bits
+    template<typename T>
+    constexpr uint64_t value_to_bits(T value) noexcept {
+        if constexpr (std::is_enum_v<T>)
+            return static_cast<uint64_t>(static_cast<std::underlying_type_t<T>>(value));
+        else
+            return static_cast<uint64_t>(value);
+    }
+
+    /// Reads a single field of the frame from the @p reader
+    template<typename Field, bit_order Order>
+    constexpr typename bit_field_values<Field>::type read_field(bit_reader<Order> &reader) noexcept {
+        if constexpr (is_bit_padding<Field>::value) {
+            reader.skip(Field::bitsize);
+            return { };
+        } else {
+            using value_type = typename Field::value_type;
+            return { bits_to_value<value_type, Field::bitsize>(reader.template read<Field::bitsize>()) };
+        }
+    }
+
+    /// Writes subsequent fields of the frame into the @p writer ( @p I is index of the @p Field 's value in @p values )
+    template<std::size_t I, typename Field, typename... Rest, bit_order Order, typename Tuple>
+    constexpr void write_fields(bit_writer<Order> &writer, const Tuple &values) noexcept {
+
+        constexpr bool padding = is_bit_padding<Field>::value;
+
+        if constexpr (padding) {
+            for(std::size_t n = Field::bitsize; n > 0; ) {
+                std::size_t chunk = std::min(n, doubleword_bitsize - byte_bitsize);
+                writer.write(0, chunk);
+                n -= chunk;
+            }
+        } else
+            writer.template write<Field::bitsize>(value_to_bits(std::get<I>(values)));
+
+        if constexpr (sizeof...(Rest) > 0)
+            write_fields<(padding ? I : I + 1), Rest...>(writer, values);
+    }
+
+}
+
+
+template<typename... Fields>
+template<bit_order Order>
+constexpr typename bit_layout<Fields...>::tuple_type bit_layout<Fields...>::decode(bit_reader<Order> &reader) noexcept {
+
+    // Braced initialization guarantees left-to-right order of reads
+    std::tuple<typename details::bit_field_values<Fields>::type...> parts {
+        details::read_field<Fields>(reader)...
+    };
+
+    return std::apply([](auto&... part) { return std::tuple_cat(part...); }, parts);
+}
+
+
+template<typename... Fields>
+template<typename T, bit_order Order>
+constexpr T bit_layout<Fields...>::decode_as(bit_reader<Order> &reader) noexcept {
+    return std::apply([](auto&&... value) { return T{ value... }; }, decode(reader));
+}
+
+
+template<typename... Fields>
+template<bit_order Order>
+constexpr void bit_layout<Fields...>::encode(bit_writer<Order> &writer, const tuple_type &values) noexcept {
+    if constexpr (sizeof...(Fields) > 0)
+        details::write_fields<0, Fields...>(writer, values);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
@@ -0,0 +1,452 @@
+/* ============================================================================================================================ *//**
+ * @file       dynamic_bitset.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 3:58:21 am
+ * @modified   Monday, 19th October 2026 3:58:21 am
+ * @project    cpp-utils
+ * @brief      Implementation of the dynamic_bitset class
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_BIT_DYNAMIC_BITSET_H__
+#define __ESTD_BIT_DYNAMIC_BITSET_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <bit>
+// Intrinsics
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+// Private includes
+#include "estd/dynamic_bitset.hpp"
+#include "estd/named_bitset.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ============================================================ Kernels =========================================================== */
+
+namespace details {
+
+    /**
+     * @returns
+     *    index of the @p k (counting from 0, @p k < popcount( @p word )) set bit of the @p word
+     */
+    inline std::size_t select_in_word(uint64_t word, std::size_t k) noexcept {
+
+    #if defined(__BMI2__)
+        return std::countr_zero(_pdep_u64(uint64_t(1) << k, word));
+    #else
+        for(; k > 0; --k)
+            word &= (word - 1);
+        return std::countr_zero(word);
+    #endif
+    }
+
+}
+
+/* ======================================================== Bitmap summary ======================================================== */
+
+namespace details {
+
+    template<typename Predicate>
+    void bitmap_summary::build(std::size_t n, Predicate &&marked) {
+
+        levels.clear();
+
+        if(n == 0)
+            return;
+
+        // Lowest level
+        std::vector<uint64_t> level((n + doubleword_bitsize - 1) / doubleword_bitsize, 0);
+        for(std::size_t i = 0; i < n; ++i)
+            level[i / doubleword_bitsize] |= (uint64_t(marked(i)) << (i % doubleword_bitsize));
+        levels.push_back(std::move(level));
+
+        // Higher levels
+        while(levels.back().size() > 1) {
+
+            const auto &below = levels.back();
+
+            std::vector<uint64_t> above((below.size() + doubleword_bitsize - 1) / doubleword_bitsize, 0);
+            for(std::size_t i = 0; i < below.size(); ++i)
+                above[i / doubleword_bitsize] |= (uint64_t(below[i] != 0) << (i % doubleword_bitsize));
+
+            levels.push_back(std::move(above));
+        }
+    }
+
+
+    void bitmap_summary::mark(std::size_t i) noexcept {
+        for(auto &level : levels) {
+
+            uint64_t &word     = level[i / doubleword_bitsize];
+            uint64_t  previous = word;
+
+            word |= (uint64_t(1) << (i % doubleword_bitsize));
+
+            // Higher levels already mark the word
+            if(previous != 0)
+                break;
+
+            i /= doubleword_bitsize;
+        }
+    }
+
+
+    void bitmap_summary::unmark(std::size_t i) noexcept {
+        for(auto &level : levels) {
+
+            uint64_t &word = level[i / doubleword_bitsize];
+
+            word &= ~(uint64_t(1) << (i % doubleword_bitsize));
+
+            // Higher levels still have to mark the word
+            if(word != 0)
+                break;
+
+            i /= doubleword_bitsize;
+        }
+    }
+
+
+    bool bitmap_summary::any() const noexcept {
+        return not levels.empty() and levels.back()[0] != 0;
+    }
+
+
+    std::size_t bitmap_summary::find_from(std::size_t i) const noexcept {
+
+        std::size_t level = 0;
+
+        // Climb up until a level having marked bit not lower than the searched one is found
+        for(;; ++level) {
+
+            if(level == levels.size())
+                return npos;
+
+            std::size_t index = i / doubleword_bitsize;
+
+            if(index >= levels[level].size())
+                return npos;
+
+            uint64_t word = levels[level][index] & (~uint64_t(0) << (i % doubleword_bitsize));
+
+            if(word != 0) {
+                i = index * doubleword_bitsize + std::countr_zero(word);
+                break;
+            }
+
+            i = index + 1;
+        }
+
+        // Descend following the lowest marked bits
+        while(level-- > 0)
+            i = i * doubleword_bitsize + std::countr_zero(levels[level][i]);
+
+        return i;
+    }
+
+}
+
+/* ========================================================= Public ctors ========================================================= */
+
+dynamic_bitset::dynamic_bitset(std::size_t size, bool value) {
+    resize(size, value);
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+void dynamic_bitset::resize(std::size_t size, bool value) {
+
+    std::size_t old_bits = bits;
+
+    // Fill the tail of the last word when growing the set with set bits
+    if(value and size > old_bits and old_bits % word_bitsize != 0)
+        words.back() |= ~valid_mask(words.size() - 1);
+
+    bits = size;
+    words.resize((size + word_bitsize - 1) / word_bitsize, value ? ~word_type(0) : word_type(0));
+
+    // Clear bits past the size of the set
+    if(not words.empty())
+        words.back() &= valid_mask(words.size() - 1);
+
+    rebuild();
+}
+
+
+bool dynamic_bitset::test(std::size_t pos) const noexcept {
+    return (words[pos / word_bitsize] >> (pos % word_bitsize)) & 1;
+}
+
+
+void dynamic_bitset::set(std::size_t pos, bool value) noexcept {
+
+    std::size_t i        = pos / word_bitsize;
+    word_type   previous = words[i];
+    word_type   mask     = word_type(1) << (pos % word_bitsize);
+
+    words[i] = value ? (previous | mask) : (previous & ~mask);
+
+    update(i, previous);
+}
+
+
+void dynamic_bitset::set() {
+
+    std::fill(words.begin(), words.end(), ~word_type(0));
+
+    if(not words.empty())
+        words.back() &= valid_mask(words.size() - 1);
+
+    rebuild();
+}
+
+
+void dynamic_bitset::reset(std::size_t pos) noexcept {
+    set(pos, false);
+}
+
+
+void dynamic_bitset::reset() {
+
+    std::fill(words.begin(), words.end(), word_type(0));
+
+    rebuild();
+}
+
+
+void dynamic_bitset::flip(std::size_t pos) noexcept {
+
+    std::size_t i        = pos / word_bitsize;
+    word_type   previous = words[i];
+
+    words[i] ^= (word_type(1) << (pos % word_bitsize));
+
+    update(i, previous);
+}
+
+
+std::size_t dynamic_bitset::count() const noexcept {
+
+    std::size_t result = 0;
+    std::size_t i      = 0;
+
+#if defined(__AVX2__)
+    if(words.size() * sizeof(word_type) >= details::bitset_simd_threshold) {
+
+        std::size_t simd_words = words.size() - words.size() % (sizeof(__m256i) / sizeof(word_type));
+
+        result += details::bitset_count_simd(reinterpret_cast<const unsigned char*>(words.data()), simd_words * sizeof(word_type));
+        i       = simd_words;
+    }
+#endif
+
+    for(; i < words.size(); ++i)
+        result += std::popcount(words[i]);
+
+    return result;
+}
+
+
+bool dynamic_bitset::any() const noexcept {
+    return set_summary.any();
+}
+
+
+bool dynamic_bitset::none() const noexcept {
+    return not set_summary.any();
+}
+
+
+bool dynamic_bitset::all() const noexcept {
+    return not clear_summary.any();
+}
+
+
+std::size_t dynamic_bitset::find_first_set() const noexcept {
+    return find_set_from(0);
+}
+
+
+std::size_t dynamic_bitset::find_first_clear() const noexcept {
+    return find_clear_from(0);
+}
+
+
+std::size_t dynamic_bitset::find_next_set(std::size_t pos) const noexcept {
+    return (pos >= bits) ? npos : find_set_from(pos + 1);
+}
+
+
+std::size_t dynamic_bitset::find_next_clear(std::size_t pos) const noexcept {
+    return (pos >= bits) ? npos : find_clear_from(pos + 1);
+}
+
+
+void dynamic_bitset::build_rank_index() {
+
+    rank_blocks.assign((words.size() + rank_block_words - 1) / rank_block_words + 1, 0);
+
+    std::size_t total = 0;
+
+    for(std::size_t i = 0; i < words.size(); ++i) {
+
+        if(i % rank_block_words == 0)
+            rank_blocks[i / rank_block_words] = total;
+
+        total += std::popcount(words[i]);
+    }
+
+    rank_blocks.back() = total;
+    rank_valid         = true;
+}
+
+
+std::size_t dynamic_bitset::rank(std::size_t pos) const noexcept {
+
+    pos = std::min(pos, bits);
+
+    std::size_t word   = pos / word_bitsize;
+    std::size_t result = 0;
+    std::size_t i      = 0;
+
+    if(rank_valid) {
+        result = rank_blocks[word / rank_block_words];
+        i      = word - word % rank_block_words;
+    }
+
+    for(; i < word; ++i)
+        result += std::popcount(words[i]);
+
+    if(pos % word_bitsize != 0)
+        result += std::popcount(words[word] & ((word_type(1) << (pos % word_bitsize)) - 1));
+
+    return result;
+}
+
+
+std::size_t dynamic_bitset::select(std::size_t k) const noexcept {
+
+    std::size_t i = 0;
+
+    // Find the last block preceded by no more than k set bits
+    if(rank_valid) {
+
+        if(k >= rank_blocks.back())
+            return npos;
+
+        auto block = std::upper_bound(rank_blocks.begin(), rank_blocks.end(), k) - 1;
+
+        k -= *block;
+        i  = static_cast<std::size_t>(block - rank_blocks.begin()) * rank_block_words;
+    }
+
+    for(; i < words.size(); ++i) {
+
+        std::size_t ones = std::popcount(words[i]);
+
+        if(k < ones)
+            return i * word_bitsize + details::select_in_word(words[i], k);
+
+        k -= ones;
+    }
+
+    return npos;
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+dynamic_bitset::word_type dynamic_bitset::valid_mask(std::size_t i) const noexcept {
+
+    if(i + 1 < words.size() or bits % word_bitsize == 0)
+        return ~word_type(0);
+
+    return (word_type(1) << (bits % word_bitsize)) - 1;
+}
+
+
+void dynamic_bitset::rebuild() {
+
+    set_summary.build(words.size(),   [this](std::size_t i) { return words[i] != 0;             });
+    clear_summary.build(words.size(), [this](std::size_t i) { return words[i] != valid_mask(i); });
+
+    rank_valid = false;
+}
+
+
+void dynamic_bitset::update(std::size_t i, word_type previous) noexcept {
+
+    word_type current = words[i];
+
+    if(current == previous)
+        return;
+
+    if(previous == 0)
+        set_summary.mark(i);
+    else if(current == 0)
+        set_summary.unmark(i);
+
+    word_type full = valid_mask(i);
+
+    if(previous == full)
+        clear_summary.mark(i);
+    else if(current == full)
+        clear_summary.unmark(i);
+
+    rank_valid = false;
+}
+
+
+std::size_t dynamic_bitset::find_set_from(std::size_t pos) const noexcept {
+
+    if(pos >= bits)
+        return npos;
+
+    std::size_t i    = pos / word_bitsize;
+    word_type   word = words[i] & (~word_type(0) << (pos % word_bitsize));
+
+    if(word != 0)
+        return i * word_bitsize + std::countr_zero(word);
+
+    i = set_summary.find_from(i + 1);
+
+    if(i == npos)
+        return npos;
+
+    return i * word_bitsize + std::countr_zero(words[i]);
+}
+
+
+std::size_t dynamic_bitset::find_clear_from(std::size_t pos) const noexcept {
+
+    if(pos >= bits)
+        return npos;
+
+    std::size_t i    = pos / word_bitsize;
+    word_type   word = ~words[i] & valid_mask(i) & (~word_type(0) << (pos % word_bitsize));
+
+    if(word != 0)
+        return i * word_bitsize + std::countr_zero(word);
+
+    i = clear_summary.find_from(i + 1);
+
+    if(i == npos)
+        return npos;
+
+    return i * word_bitsize + std::countr_zero(~words[i] & valid_mask(i));
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
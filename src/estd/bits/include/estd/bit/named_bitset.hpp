@@ -0,0 +1,347 @@
+/* ============================================================================================================================ *//**
+ * @file       named_bitset.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 3:10:44 am
+ * @modified   Monday, 19th October 2026 8:47:05 pm
+ * @project    cpp-utils
+ * @brief      Implementation of word-level scanning methods of the named_bitset class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_BIT_NAMED_BITSET_H__
+#define __ESTD_BIT_NAMED_BITSET_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+// Intrinsics
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+// Private includes
+#include "estd/named_bitset.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ============================================================ Kernels =========================================================== */
+
+namespace details {
+
+    /// Number of bits in the word used to scan bitsets
+    inline constexpr std::size_t bitset_word_bitsize = 64;
+
+    /// Number of bytes of the object representation of std::bitset<N> holding bits of the set
+    template<std::size_t N>
+    inline constexpr std::size_t bitset_bytes = (N + byte_bitsize - 1) / byte_bitsize;
+
+    /// Number of 64-bit words holding bits of std::bitset<N>
+    template<std::size_t N>
+    inline constexpr std::size_t bitset_words = (N + bitset_word_bitsize - 1) / bitset_word_bitsize;
+
+    /// Indicates whether bits of std::bitset can be read directly from its object representation
+    inline constexpr bool bitset_word_access = (std::endian::native == std::endian::little);
+
+    /**
+     * @brief Reads @p i 64-bit word of the @p set (bits [64 * i, 64 * i + 63])
+     * @note Standard libraries (libstdc++, libc++, MSVC STL) store bits of std::bitset in the array of
+     *    integral words starting from the LSBit of the first word. On little-endian targets this makes
+     *    subsequent bytes of the object representation hold subsequent octets of the set, independently
+     *    of the size of the word used by the library. On other targets the word is assembled bit by bit
+     */
+    template<std::size_t N>
+    inline uint64_t bitset_word(const std::bitset<N> &set, std::size_t i) noexcept {
+
+        uint64_t word = 0;
+
+        if constexpr (bitset_word_access) {
+
+            static_assert(sizeof(std::bitset<N>) >= bitset_bytes<N>);
+
+            const unsigned char *bytes  = reinterpret_cast<const unsigned char*>(&set);
+            std::size_t          offset = i * sizeof(uint64_t);
+
+            if(offset + sizeof(uint64_t) <= bitset_bytes<N>)
+                std::memcpy(&word, bytes + offset, sizeof(uint64_t));
+            else
+                std::memcpy(&word, bytes + offset, bitset_bytes<N> - offset);
+
+        } else {
+
+            std::size_t first = i * bitset_word_bitsize;
+            std::size_t last  = std::min(first + bitset_word_bitsize, N);
+
+            for(std::size_t bit = first; bit < last; ++bit)
+                word |= (uint64_t(set.test(bit)) << (bit - first));
+        }
+
+        // Do not rely on the library keeping unused bits of the last word cleared
+        if constexpr (N % bitset_word_bitsize != 0) {
+            if(i == bitset_words<N> - 1)
+                word &= (uint64_t(1) << (N % bitset_word_bitsize)) - 1;
+        }
+
+        return word;
+    }
+
+#if defined(__AVX2__)
+
+    /// Minimal size of the set (in bytes) processed with AVX2 kernels
+    inline constexpr std::size_t bitset_simd_threshold = 64;
+
+    /**
+     * @brief Number of leading bytes of std::bitset<N> processed with AVX2 kernels - whole 32-byte blocks of bytes
+     *    holding only bits of the set (the partially used last byte is left to the masked bitset_word())
+     */
+    template<std::size_t N>
+    inline constexpr std::size_t bitset_simd_bytes = (N / byte_bitsize) - (N / byte_bitsize) % sizeof(__m256i);
+
+    /**
+     * @brief AVX2 kernel counting set bits of @p n ( @p n multiple of 32) bytes at @p bytes with
+     *    the nibble-lookup (PSHUFB) method
+     */
+    inline std::size_t bitset_count_simd(const unsigned char *bytes, std::size_t n) noexcept {
+
+        const __m256i lookup = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+        );
+        const __m256i low_mask = _mm256_set1_epi8(0x0F);
+
+        __m256i acc = _mm256_setzero_si256();
+
+        for(std::size_t i = 0; i < n; i += sizeof(__m256i)) {
+
+            __m256i v   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+            __m256i lo  = _mm256_and_si256(v, low_mask);
+            __m256i hi  = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+            __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+        }
+
+        return static_cast<std::size_t>(
+            _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1) +
+            _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3)
+        );
+    }
+
+    /**
+     * @brief AVX2 kernel checking whether any bit of @p n ( @p n multiple of 32) bytes at @p bytes is set
+     */
+    inline bool bitset_any_simd(const unsigned char *bytes, std::size_t n) noexcept {
+
+        __m256i acc = _mm256_setzero_si256();
+
+        for(std::size_t i = 0; i < n; i += sizeof(__m256i))
+            acc = _mm256_or_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i)));
+
+        return not _mm256_testz_si256(acc, acc);
+    }
+
+#endif
+
+}
+
+/* ======================================================== Set bits range ======================================================== */
+
+namespace details {
+
+    template<std::size_t N, typename Value>
+    class set_bits_iterator {
+
+    public: /* ------------------------------------------------- Public types ------------------------------------------------- */
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Value;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = Value;
+
+    public: /* ------------------------------------------------- Public ctors ------------------------------------------------- */
+
+        constexpr set_bits_iterator() = default;
+
+        constexpr set_bits_iterator(const named_bitset<N> *set, std::size_t pos) noexcept :
+            set{ set },
+            pos{ pos }
+        { }
+
+    public: /* ----------------------------------------------- Public operators ----------------------------------------------- */
+
+        constexpr Value operator*() const noexcept {
+            return static_cast<Value>(pos);
+        }
+
+        set_bits_iterator &operator++() noexcept {
+            pos = set->find_next(pos);
+            return *this;
+        }
+
+        set_bits_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr bool operator==(const set_bits_iterator &other) const noexcept {
+            return pos == other.pos;
+        }
+
+    private: /* ------------------------------------------------ Private data ------------------------------------------------- */
+
+        /// Iterated set
+        const named_bitset<N> *set { nullptr };
+        /// Index of the current bit
+        std::size_t pos { N };
+
+    };
+
+    template<std::size_t N, typename Value>
+    class set_bits_range {
+
+    public: /* ------------------------------------------------- Public types ------------------------------------------------- */
+
+        using iterator = set_bits_iterator<N, Value>;
+
+    public: /* ------------------------------------------------- Public ctors ------------------------------------------------- */
+
+        constexpr set_bits_range(const named_bitset<N> *set) noexcept :
+            set{ set }
+        { }
+
+    public: /* ------------------------------------------------ Public methods ------------------------------------------------ */
+
+        iterator begin() const noexcept { return iterator{ set, set->find_first() }; }
+        iterator end() const noexcept { return iterator{ set, N }; }
+
+    private: /* ------------------------------------------------ Private data ------------------------------------------------- */
+
+        /// Iterated set
+        const named_bitset<N> *set;
+
+    };
+
+}
+
+/* ========================================================= Named bitset ========================================================= */
+
+template<std::size_t N>
+std::size_t named_bitset<N>::count() const noexcept {
+
+    std::size_t result = 0;
+    std::size_t i      = 0;
+
+#if defined(__AVX2__)
+    if constexpr (details::bitset_word_access and details::bitset_bytes<N> >= details::bitset_simd_threshold) {
+
+        constexpr std::size_t simd_bytes = details::bitset_simd_bytes<N>;
+
+        result += details::bitset_count_simd(reinterpret_cast<const unsigned char*>(this), simd_bytes);
+        i       = simd_bytes / sizeof(uint64_t);
+    }
+#endif
+
+    for(; i < details::bitset_words<N>; ++i)
+        result += std::popcount(details::bitset_word<N>(*this, i));
+
+    return result;
+}
+
+
+template<std::size_t N>
+bool named_bitset<N>::any() const noexcept {
+
+    std::size_t i = 0;
+
+#if defined(__AVX2__)
+    if constexpr (details::bitset_word_access and details::bitset_bytes<N> >= details::bitset_simd_threshold) {
+
+        constexpr std::size_t simd_bytes = details::bitset_simd_bytes<N>;
+
+        if(details::bitset_any_simd(reinterpret_cast<const unsigned char*>(this), simd_bytes))
+            return true;
+
+        i = simd_bytes / sizeof(uint64_t);
+    }
+#endif
+
+    for(; i < details::bitset_words<N>; ++i) {
+        if(details::bitset_word<N>(*this, i) != 0)
+            return true;
+    }
+
+    return false;
+}
+
+
+template<std::size_t N>
+bool named_bitset<N>::none() const noexcept {
+    return not any();
+}
+
+
+template<std::size_t N>
+std::size_t named_bitset<N>::find_first() const noexcept {
+
+    for(std::size_t i = 0; i < details::bitset_words<N>; ++i) {
+        if(uint64_t word = details::bitset_word<N>(*this, i); word != 0)
+            return i * details::bitset_word_bitsize + std::countr_zero(word);
+    }
+
+    return N;
+}
+
+
+template<std::size_t N>
+std::size_t named_bitset<N>::find_next(std::size_t pos) const noexcept {
+
+    if(++pos >= N)
+        return N;
+
+    std::size_t i    = pos / details::bitset_word_bitsize;
+    uint64_t    word = details::bitset_word<N>(*this, i) & (~uint64_t(0) << (pos % details::bitset_word_bitsize));
+
+    while(word == 0) {
+
+        if(++i == details::bitset_words<N>)
+            return N;
+
+        word = details::bitset_word<N>(*this, i);
+    }
+
+    return i * details::bitset_word_bitsize + std::countr_zero(word);
+}
+
+
+template<std::size_t N>
+template<typename Value, typename F>
+    requires (std::is_integral_v<Value> or std::is_enum_v<Value>)
+void named_bitset<N>::for_each_set(F &&f) const {
+    for(std::size_t i = 0; i < details::bitset_words<N>; ++i) {
+        for(uint64_t word = details::bitset_word<N>(*this, i); word != 0; word &= (word - 1))
+            f(static_cast<Value>(i * details::bitset_word_bitsize + std::countr_zero(word)));
+    }
+}
+
+
+template<std::size_t N>
+template<typename Value>
+    requires (std::is_integral_v<Value> or std::is_enum_v<Value>)
+details::set_bits_range<N, Value> named_bitset<N>::set_bits() const noexcept {
+    return details::set_bits_range<N, Value>{ this };
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
@@ -0,0 +1,409 @@
+/* ============================================================================================================================ *//**
+ * @file       packed_array.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:04:12 am
+ * @modified   Monday, 19th October 2026 1:04:12 am
+ * @project    cpp-utils
+ * @brief      Implementation of containers of unsigned integers stored contiguously at the fixed bit width
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_BIT_PACKED_ARRAY_H__
+#define __ESTD_BIT_PACKED_ARRAY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <bit>
+#include <utility>
+// Intrinsics
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+// Private includes
+#include "estd/packed_array.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ============================================================ Kernels =========================================================== */
+
+namespace details {
+
+    template<std::size_t Bits>
+    constexpr std::size_t packed_words(std::size_t n) noexcept {
+        return (n * Bits + doubleword_bitsize - 1) / doubleword_bitsize + 1;
+    }
+
+    /// Mask of @p Bits LSBits
+    template<std::size_t Bits>
+    inline constexpr uint64_t packed_mask = (Bits == doubleword_bitsize) ? ~uint64_t(0) : ((uint64_t(1) << Bits) - 1);
+
+    /**
+     * @brief Reads @p index element of @p Bits bits from @p words
+     * @note Element is always assembled from two subsequent words (shifts are split into two
+     *    parts so that none of them is wider than 63 bits) which makes the access branchless
+     */
+    template<std::size_t Bits>
+    constexpr uint64_t packed_get(const uint64_t *words, std::size_t index) noexcept {
+
+        std::size_t offset = index * Bits;
+        std::size_t word   = offset / doubleword_bitsize;
+        std::size_t shift  = offset % doubleword_bitsize;
+
+        uint64_t value = (words[word] >> shift) | ((words[word + 1] << 1) << (doubleword_bitsize - 1 - shift));
+
+        return value & packed_mask<Bits>;
+    }
+
+    /**
+     * @brief Writes LSBits of @p value to the @p index element of @p Bits bits in @p words
+     */
+    template<std::size_t Bits>
+    constexpr void packed_set(uint64_t *words, std::size_t index, uint64_t value) noexcept {
+
+        std::size_t offset = index * Bits;
+        std::size_t word   = offset / doubleword_bitsize;
+        std::size_t shift  = offset % doubleword_bitsize;
+
+        constexpr uint64_t mask = packed_mask<Bits>;
+
+        value &= mask;
+
+        words[word]     = (words[word]     & ~(mask << shift))
+                        | (value << shift);
+        words[word + 1] = (words[word + 1] & ~((mask >> 1) >> (doubleword_bitsize - 1 - shift)))
+                        | ((value >> 1) >> (doubleword_bitsize - 1 - shift));
+    }
+
+#if defined(__AVX2__)
+
+    /**
+     * @brief AVX2 kernel copying groups of 8 elements starting at @p first one into @p dst . Each group
+     *    starts at the byte boundary, so elements are gathered with 32-bit loads at constant byte offsets
+     * @note Kernel supports elements up to 25 bits (so that each element fits a 32-bit load after
+     *    the byte alignment) on little-endian targets; @p first must be multiple of 8
+     * @returns
+     *    number of processed elements (multiple of 8)
+     */
+    template<std::size_t Bits, typename T>
+    inline std::size_t packed_unpack_simd(const uint64_t *words, std::size_t first, std::size_t count, T *dst) noexcept {
+
+        if constexpr (Bits > 25 or sizeof(T) > sizeof(uint32_t) or std::endian::native != std::endian::little) {
+            return 0;
+        } else {
+
+            const uint8_t *src = reinterpret_cast<const uint8_t*>(words) + (first * Bits) / byte_bitsize;
+
+            // Byte offsets and bit shifts of subsequent elements of the group
+            const __m256i offsets = []<std::size_t... I>(std::index_sequence<I...>) {
+                return _mm256_setr_epi32(static_cast<int>((I * Bits) / byte_bitsize)...);
+            }(std::make_index_sequence<byte_bitsize>{});
+            const __m256i shifts = []<std::size_t... I>(std::index_sequence<I...>) {
+                return _mm256_setr_epi32(static_cast<int>((I * Bits) % byte_bitsize)...);
+            }(std::make_index_sequence<byte_bitsize>{});
+            const __m256i mask = _mm256_set1_epi32(static_cast<int>(packed_mask<Bits>));
+
+            std::size_t i = 0;
+
+            // Each group of 8 elements occupies exactly Bits bytes
+            for(; i + byte_bitsize <= count; i += byte_bitsize, src += Bits) {
+
+                __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), offsets, 1);
+
+                v = _mm256_and_si256(_mm256_srlv_epi32(v, shifts), mask);
+
+                if constexpr (sizeof(T) == sizeof(uint32_t)) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+                } else if constexpr (sizeof(T) == sizeof(uint16_t)) {
+                    v = _mm256_permute4x64_epi64(_mm256_packus_epi32(v, v), 0b1000);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(v));
+                } else {
+                    v = _mm256_packus_epi16(_mm256_packus_epi32(v, v), v);
+                    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4));
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(v));
+                }
+            }
+
+            return i;
+        }
+    }
+
+#else
+
+    template<std::size_t Bits, typename T>
+    inline std::size_t packed_unpack_simd(const uint64_t *, std::size_t, std::size_t, T *) noexcept {
+        return 0;
+    }
+
+#endif
+
+    /**
+     * @brief Copies @p count elements starting at @p first one into @p dst using the SIMD kernel for
+     *    the groups of 8 elements and single-element reads for the head/tail
+     */
+    template<std::size_t Bits, typename T>
+    inline void packed_unpack(const uint64_t *words, std::size_t first, std::size_t count, T *dst) noexcept {
+
+        std::size_t i = 0;
+
+        for(; i < count and (first + i) % byte_bitsize != 0; ++i)
+            dst[i] = static_cast<T>(packed_get<Bits>(words, first + i));
+
+        i += packed_unpack_simd<Bits>(words, first + i, count - i, dst + i);
+
+        for(; i < count; ++i)
+            dst[i] = static_cast<T>(packed_get<Bits>(words, first + i));
+    }
+
+    /**
+     * @brief Writes @p count elements of @p src starting at the @p first element of @p words . Elements
+     *    are collected in the 64-bit accumulator so that each word of the storage is written once
+     */
+    template<std::size_t Bits, typename T>
+    inline void packed_pack(uint64_t *words, std::size_t first, std::size_t count, const T *src) noexcept {
+
+        if(count == 0)
+            return;
+
+        std::size_t offset = first * Bits;
+        std::size_t word   = offset / doubleword_bitsize;
+        std::size_t filled = offset % doubleword_bitsize;
+
+        // Preserve elements preceding the first one in the first word
+        uint64_t acc = words[word] & ((uint64_t(1) << filled) - 1);
+
+        for(std::size_t i = 0; i < count; ++i) {
+
+            uint64_t value = static_cast<uint64_t>(src[i]) & packed_mask<Bits>;
+
+            acc |= (value << filled);
+
+            if(filled + Bits >= doubleword_bitsize) {
+
+                std::size_t consumed = doubleword_bitsize - filled;
+
+                words[word++] = acc;
+                acc           = (consumed < Bits) ? (value >> consumed) : 0;
+                filled        = filled + Bits - doubleword_bitsize;
+
+            } else
+                filled += Bits;
+        }
+
+        // Preserve elements following the last one in the last word
+        if(filled > 0)
+            words[word] = (words[word] & ~((uint64_t(1) << filled) - 1)) | acc;
+    }
+
+}
+
+/* ======================================================= Packed reference ======================================================= */
+
+namespace details {
+
+    template<std::size_t Bits>
+    constexpr packed_reference<Bits>::packed_reference(uint64_t *words, std::size_t index) noexcept :
+        words{ words },
+        index{ index }
+    { }
+
+
+    template<std::size_t Bits>
+    constexpr packed_reference<Bits> &packed_reference<Bits>::operator=(value_type value) noexcept {
+        packed_set<Bits>(words, index, value);
+        return *this;
+    }
+
+
+    template<std::size_t Bits>
+    constexpr packed_reference<Bits> &packed_reference<Bits>::operator=(const packed_reference &other) noexcept {
+        return (*this = static_cast<value_type>(other));
+    }
+
+
+    template<std::size_t Bits>
+    constexpr packed_reference<Bits>::operator value_type() const noexcept {
+        return static_cast<value_type>(packed_get<Bits>(words, index));
+    }
+
+}
+
+/* ========================================================= Packed array ========================================================= */
+
+template<std::size_t Bits, std::size_t N>
+    requires ((Bits > 0) and (Bits <= 64))
+constexpr typename packed_array<Bits, N>::value_type packed_array<Bits, N>::get(std::size_t index) const noexcept {
+    return static_cast<value_type>(details::packed_get<Bits>(storage.data(), index));
+}
+
+
+template<std::size_t Bits, std::size_t N>
+    requires ((Bits > 0) and (Bits <= 64))
+constexpr void packed_array<Bits, N>::set(std::size_t index, value_type value) noexcept {
+    details::packed_set<Bits>(storage.data(), index, value);
+}
+
+
+template<std::size_t Bits, std::size_t N>
+    requires ((Bits > 0) and (Bits <= 64))
+constexpr void packed_array<Bits, N>::fill(value_type value) noexcept {
+    for(std::size_t i = 0; i < N; ++i)
+        details::packed_set<Bits>(storage.data(), i, value);
+}
+
+
+template<std::size_t Bits, std::size_t N>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_array<Bits, N>::unpack(std::size_t first, std::size_t count, value_type *dst) const noexcept {
+    details::packed_unpack<Bits>(storage.data(), first, count, dst);
+}
+
+
+template<std::size_t Bits, std::size_t N>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_array<Bits, N>::pack(std::size_t first, std::size_t count, const value_type *src) noexcept {
+    details::packed_pack<Bits>(storage.data(), first, count, src);
+}
+
+
+template<std::size_t Bits, std::size_t N>
+    requires ((Bits > 0) and (Bits <= 64))
+constexpr typename packed_array<Bits, N>::value_type packed_array<Bits, N>::operator[](std::size_t index) const noexcept {
+    return get(index);
+}
+
+
+template<std::size_t Bits, std::size_t N>
+    requires ((Bits > 0) and (Bits <= 64))
+constexpr typename packed_array<Bits, N>::reference packed_array<Bits, N>::operator[](std::size_t index) noexcept {
+    return reference{ storage.data(), index };
+}
+
+/* ========================================================= Packed vector ======================================================== */
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+packed_vector<Bits>::packed_vector(std::size_t n, value_type value) {
+    resize(n, value);
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+std::size_t packed_vector<Bits>::capacity() const noexcept {
+    return (storage.capacity() == 0) ? 0 : ((storage.capacity() - 1) * doubleword_bitsize / Bits);
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_vector<Bits>::reserve(std::size_t n) {
+    storage.reserve(details::packed_words<Bits>(n));
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_vector<Bits>::resize(std::size_t n, value_type value) {
+
+    /**
+     * @note Bits of the storage past the last element are kept cleared, so growing the vector
+     *    with zeros requires no writes besides reallocation
+     */
+    if(n < count) {
+
+        storage.resize(details::packed_words<Bits>(n));
+
+        std::size_t offset = n * Bits;
+        std::size_t word   = offset / doubleword_bitsize;
+
+        storage[word] &= ((uint64_t(1) << (offset % doubleword_bitsize)) - 1);
+        std::fill(storage.begin() + word + 1, storage.end(), 0);
+
+    } else {
+
+        storage.resize(details::packed_words<Bits>(n), 0);
+
+        if(value != 0) {
+            for(std::size_t i = count; i < n; ++i)
+                details::packed_set<Bits>(storage.data(), i, value);
+        }
+    }
+
+    count = n;
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_vector<Bits>::clear() noexcept {
+    storage.clear();
+    count = 0;
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_vector<Bits>::push_back(value_type value) {
+
+    std::size_t words = details::packed_words<Bits>(count + 1);
+
+    if(words > storage.size())
+        storage.resize(words, 0);
+
+    details::packed_set<Bits>(storage.data(), count++, value);
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+typename packed_vector<Bits>::value_type packed_vector<Bits>::get(std::size_t index) const noexcept {
+    return static_cast<value_type>(details::packed_get<Bits>(storage.data(), index));
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_vector<Bits>::set(std::size_t index, value_type value) noexcept {
+    details::packed_set<Bits>(storage.data(), index, value);
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_vector<Bits>::unpack(std::size_t first, std::size_t n, value_type *dst) const noexcept {
+    details::packed_unpack<Bits>(storage.data(), first, n, dst);
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+void packed_vector<Bits>::pack(std::size_t first, std::size_t n, const value_type *src) noexcept {
+    details::packed_pack<Bits>(storage.data(), first, n, src);
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+typename packed_vector<Bits>::value_type packed_vector<Bits>::operator[](std::size_t index) const noexcept {
+    return get(index);
+}
+
+
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+typename packed_vector<Bits>::reference packed_vector<Bits>::operator[](std::size_t index) noexcept {
+    return reference{ storage.data(), index };
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
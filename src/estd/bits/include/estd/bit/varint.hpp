@@ -0,0 +1,315 @@
+/* ============================================================================================================================ *//**
+ * @file       varint.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:47:30 am
+ * @modified   Monday, 19th October 2026 1:47:30 am
+ * @project    cpp-utils
+ * @brief      Implementation of the variable-length integers (unsigned LEB128) codec with zigzag mapping of signed values
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_BIT_VARINT_H__
+#define __ESTD_BIT_VARINT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <bit>
+#include <cstring>
+// Intrinsics
+#if defined(__AVX2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+// Private includes
+#include "estd/varint.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ============================================================ Kernels =========================================================== */
+
+namespace details {
+
+    /// Number of payload bits in a single byte of the varint
+    inline constexpr std::size_t varint_group_bitsize = 7;
+
+    /// Mask of continuation bits of all bytes of the 64-bit word
+    inline constexpr uint64_t varint_continuation_mask = 0x8080808080808080ULL;
+
+    /// Loads unaligned little-endian 64-bit word from @p src
+    inline uint64_t load_varint_word(const uint8_t *src) noexcept {
+
+        uint64_t word;
+        std::memcpy(&word, src, sizeof(word));
+
+        if constexpr (std::endian::native != std::endian::little)
+            word = __builtin_bswap64(word);
+
+        return word;
+    }
+
+    /// Stores @p word as unaligned little-endian 64-bit word at @p dst
+    inline void store_varint_word(uint8_t *dst, uint64_t word) noexcept {
+
+        if constexpr (std::endian::native != std::endian::little)
+            word = __builtin_bswap64(word);
+
+        std::memcpy(dst, &word, sizeof(word));
+    }
+
+    /**
+     * @brief Gathers 7-bit groups of the varint of @p len ( @p len <= 8 ) bytes held by LSBytes of the @p word
+     */
+    inline uint64_t varint_compact(uint64_t word, std::size_t len) noexcept {
+
+        uint64_t x = word & (~uint64_t(0) >> (doubleword_bitsize - len * byte_bitsize));
+
+    #if defined(__BMI2__)
+        return _pext_u64(x, 0x7F7F7F7F7F7F7F7FULL);
+    #else
+        x &= 0x7F7F7F7F7F7F7F7FULL;
+        x  = ((x & 0x7F007F007F007F00ULL) >> 1) | (x & 0x007F007F007F007FULL);
+        x  = ((x & 0x3FFF00003FFF0000ULL) >> 2) | (x & 0x00003FFF00003FFFULL);
+        x  = ((x & 0x0FFFFFFF00000000ULL) >> 4) | (x & 0x000000000FFFFFFFULL);
+        return x;
+    #endif
+    }
+
+    /**
+     * @brief Spreads @p value ( @p value < 2^56 ) into 7-bit groups of subsequent bytes (inverse of varint_compact())
+     */
+    inline uint64_t varint_spread(uint64_t value) noexcept {
+
+    #if defined(__BMI2__)
+        return _pdep_u64(value, 0x7F7F7F7F7F7F7F7FULL);
+    #else
+        uint64_t x = value;
+        x = ((x & 0x00FFFFFFF0000000ULL) << 4) | (x & 0x000000000FFFFFFFULL);
+        x = ((x & 0x0FFFC0000FFFC000ULL) << 2) | (x & 0x00003FFF00003FFFULL);
+        x = ((x & 0x3F803F803F803F80ULL) << 1) | (x & 0x007F007F007F007FULL);
+        return x;
+    #endif
+    }
+
+    /**
+     * @brief Decodes subsequent varints of up to 8 bytes terminated within the block at @p src
+     * @note At least 8 bytes past the end of the block must be readable
+     *
+     * @tparam Stride
+     *    number of bits of @p terminators per byte of the block
+     * @param terminators
+     *    mask with the lowest bit of each group of @p Stride bits set for bytes terminating varints
+     * @returns
+     *    number of consumed bytes
+     */
+    template<std::size_t Stride, typename Mask>
+    inline std::size_t decode_varints_block(
+        const uint8_t *src,
+        Mask terminators,
+        uint64_t *dst,
+        std::size_t &i,
+        std::size_t count
+    ) noexcept {
+
+        std::size_t start = 0;
+
+        // Iterating over set bits of the mask makes subsequent varints independent of each other
+        for(; terminators != 0 and i < count; terminators &= (terminators - 1)) {
+
+            std::size_t stop = std::countr_zero(terminators) / Stride + 1;
+            std::size_t len  = stop - start;
+
+            // Longer varints are left for the scalar decoder
+            if(len > sizeof(uint64_t))
+                break;
+
+            dst[i++] = varint_compact(load_varint_word(src + start), len);
+            start    = stop;
+        }
+
+        return start;
+    }
+
+#if defined(__AVX2__)
+
+    /**
+     * @brief AVX2 kernel expanding 32 single-byte varints held by @p bytes into @p dst
+     */
+    inline void expand_single_byte_varints_simd(__m256i bytes, uint64_t *dst) noexcept {
+
+        __m128i low  = _mm256_castsi256_si128(bytes);
+        __m128i high = _mm256_extracti128_si256(bytes, 1);
+
+        for(std::size_t i = 0; i < 4; ++i) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst +  0 + 4 * i), _mm256_cvtepu8_epi64(low));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 16 + 4 * i), _mm256_cvtepu8_epi64(high));
+            low  = _mm_srli_si128(low,  4);
+            high = _mm_srli_si128(high, 4);
+        }
+    }
+
+#endif
+
+}
+
+/* =========================================================== Functions ========================================================== */
+
+template<typename T>
+    requires (std::is_integral_v<T> and std::is_signed_v<T>)
+constexpr std::make_unsigned_t<T> zigzag_encode(T value) noexcept {
+
+    using U = std::make_unsigned_t<T>;
+
+    return (static_cast<U>(value) << 1) ^ static_cast<U>(value >> (sizeof(T) * byte_bitsize - 1));
+}
+
+
+template<typename T>
+    requires (std::is_integral_v<T> and std::is_unsigned_v<T>)
+constexpr std::make_signed_t<T> zigzag_decode(T value) noexcept {
+    return static_cast<std::make_signed_t<T>>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+
+constexpr std::size_t varint_size(uint64_t value) noexcept {
+    return (std::bit_width(value | 1) + details::varint_group_bitsize - 1) / details::varint_group_bitsize;
+}
+
+
+constexpr std::size_t encode_varint(uint64_t value, uint8_t *dst) noexcept {
+
+    std::size_t i = 0;
+
+    for(; value >= 0x80; value >>= details::varint_group_bitsize)
+        dst[i++] = static_cast<uint8_t>(value | 0x80);
+
+    dst[i++] = static_cast<uint8_t>(value);
+
+    return i;
+}
+
+
+constexpr std::size_t decode_varint(const uint8_t *src, std::size_t size, uint64_t &value) noexcept {
+
+    value = 0;
+
+    for(std::size_t i = 0; i < size and i < varint_max_size; ++i) {
+
+        uint64_t byte = src[i];
+
+        // The last byte of 64-bit varint may carry a single bit
+        if(i == varint_max_size - 1 and byte > 1)
+            return 0;
+
+        value |= (byte & 0x7F) << (i * details::varint_group_bitsize);
+
+        if((byte & 0x80) == 0)
+            return i + 1;
+    }
+
+    return 0;
+}
+
+
+varint_batch_result encode_varints(const uint64_t *src, std::size_t count, uint8_t *dst, std::size_t size) noexcept {
+
+    uint8_t *const begin = dst;
+    uint8_t *const end   = dst + size;
+
+    // Values of up to 56 bits (8 bytes of varint) are encoded with a single word store
+    constexpr uint64_t fast_limit = uint64_t(1) << (byte_bitsize * details::varint_group_bitsize);
+
+    std::size_t i = 0;
+
+    for(; i < count; ++i) {
+
+        uint64_t value = src[i];
+
+        if(static_cast<std::size_t>(end - dst) >= sizeof(uint64_t) and value < fast_limit) {
+
+            std::size_t len = varint_size(value);
+
+            uint64_t continuation = (len > 1) ?
+                (details::varint_continuation_mask >> (doubleword_bitsize - (len - 1) * byte_bitsize)) : 0;
+
+            details::store_varint_word(dst, details::varint_spread(value) | continuation);
+            dst += len;
+
+        } else {
+
+            if(static_cast<std::size_t>(end - dst) < varint_size(value))
+                break;
+
+            dst += encode_varint(value, dst);
+        }
+    }
+
+    return { i, static_cast<std::size_t>(dst - begin) };
+}
+
+
+varint_batch_result decode_varints(const uint8_t *src, std::size_t size, uint64_t *dst, std::size_t count) noexcept {
+
+    const uint8_t *const begin = src;
+    const uint8_t *const end   = src + size;
+
+    // Size of the block of bytes examined at once with AVX2
+    [[maybe_unused]] constexpr std::size_t simd_block = 32;
+
+    std::size_t i = 0;
+
+    while(i < count) {
+
+        std::size_t available = static_cast<std::size_t>(end - src);
+        std::size_t consumed  = 0;
+
+    #if defined(__AVX2__)
+        if(available >= simd_block + sizeof(uint64_t)) {
+
+            __m256i  bytes       = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+            uint32_t terminators = ~static_cast<uint32_t>(_mm256_movemask_epi8(bytes));
+
+            // Run of 32 single-byte varints
+            if(terminators == ~uint32_t(0) and count - i >= simd_block) {
+                details::expand_single_byte_varints_simd(bytes, dst + i);
+                consumed  = simd_block;
+                i        += simd_block;
+            } else
+                consumed = details::decode_varints_block<1>(src, terminators, dst, i, count);
+
+        } else
+    #endif
+        if(available >= 2 * sizeof(uint64_t)) {
+
+            uint64_t terminators = ~details::load_varint_word(src) & details::varint_continuation_mask;
+
+            consumed = details::decode_varints_block<byte_bitsize>(src, terminators, dst, i, count);
+        }
+
+        // Varints of 9-10 bytes and the tail of the buffer
+        if(consumed == 0) {
+
+            uint64_t value;
+            consumed = decode_varint(src, available, value);
+
+            if(consumed == 0)
+                break;
+
+            dst[i++] = value;
+        }
+
+        src += consumed;
+    }
+
+    return { i, static_cast<std::size_t>(src - begin) };
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
@@ -0,0 +1,341 @@
+/* ============================================================================================================================ *//**
+ * @file       bit_stream.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 12:21:40 am
+ * @modified   Monday, 19th October 2026 12:21:40 am
+ * @project    cpp-utils
+ * @brief      Definitions of bitstream reader/writer classes and compile-time description of bit-packed frames
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_BIT_STREAM_H__
+#define __ESTD_BIT_STREAM_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+// Private includes
+#include "estd/bit.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* =========================================================== Constants ========================================================== */
+
+/**
+ * @brief Order of bits in the bitstream
+ */
+enum class bit_order {
+
+    /// Subsequent bits of the stream are stored starting from the LSBit of each byte (e.g. Intel-style CAN signals)
+    lsb_first,
+
+    /// Subsequent bits of the stream are stored starting from the MSBit of each byte (e.g. Motorola-style CAN signals)
+    msb_first
+
+};
+
+/* ========================================================== Bit reader ========================================================== */
+
+/**
+ * @brief Class reading subsequent bit fields from the bit-packed buffer
+ * @details Reader keeps a 64-bit accumulator refilled with a single (unaligned) word load whenever at
+ *    least 8 bytes of input are left. Reading past the end of the buffer yields zero bits and sets
+ *    the overrun flag
+ *
+ * @tparam Order
+ *    order of bits in the stream
+ */
+template<bit_order Order = bit_order::lsb_first>
+class bit_reader {
+
+public: /* ---------------------------------------------------- Public constants -------------------------------------------------- */
+
+    /// Order of bits in the stream
+    static constexpr bit_order order = Order;
+
+public: /* ------------------------------------------------------ Public ctors ---------------------------------------------------- */
+
+    /**
+     * @brief Constructs the reader of the @p size bytes of @p data
+     */
+    constexpr bit_reader(const uint8_t *data, std::size_t size) noexcept;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Reads @p N bits from the stream
+     * @returns
+     *    read bits aligned to the LSBit of the result
+     */
+    template<std::size_t N>
+        requires (N <= doubleword_bitsize)
+    constexpr uint64_t read() noexcept;
+
+    /**
+     * @brief Reads @p nbits bits from the stream
+     * @returns
+     *    read bits aligned to the LSBit of the result
+     */
+    constexpr uint64_t read(std::size_t nbits) noexcept;
+
+    /**
+     * @brief Reads @p N bits from the stream without consuming them
+     * @returns
+     *    read bits aligned to the LSBit of the result
+     */
+    template<std::size_t N>
+        requires (N <= doubleword_bitsize - byte_bitsize)
+    constexpr uint64_t peek() noexcept;
+
+    /**
+     * @brief Skips @p nbits bits of the stream
+     */
+    constexpr void skip(std::size_t nbits) noexcept;
+
+    /**
+     * @brief Skips bits of the stream up to the next byte boundary
+     */
+    constexpr void align() noexcept;
+
+    /**
+     * @returns
+     *    number of bits consumed from the stream
+     */
+    constexpr std::size_t position() const noexcept;
+
+    /**
+     * @returns
+     *    number of bits left in the stream ( @c 0 if reader overrun the stream)
+     */
+    constexpr std::size_t bits_left() const noexcept;
+
+    /**
+     * @returns
+     *    @c true if more bits has been read than the stream holds
+     */
+    constexpr bool overrun() const noexcept;
+
+private: /* ---------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /// Refills the accumulator so that it holds at least 56 bits
+    constexpr void refill() noexcept;
+
+    /// Consumes @p nbits ( @p nbits < 64 ) bits of the accumulator
+    constexpr uint64_t consume(std::size_t nbits) noexcept;
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Beginning of the stream
+    const uint8_t *begin;
+    /// Next byte to be loaded into the accumulator
+    const uint8_t *next;
+    /// End of the stream
+    const uint8_t *end;
+    /// Number of zero bytes loaded into the accumulator past the end of the stream
+    std::size_t padding { 0 };
+    /// Accumulator
+    uint64_t acc { 0 };
+    /// Number of valid bits in the accumulator
+    std::size_t count { 0 };
+
+};
+
+/* ========================================================== Bit writer ========================================================== */
+
+/**
+ * @brief Class writing subsequent bit fields into the bit-packed buffer
+ * @details Writer keeps a 64-bit accumulator flushed with a single (unaligned) word store whenever at
+ *    least 8 bytes of output are left. Writing past the end of the buffer discards data and sets
+ *    the overrun flag. Remaining bits are written into the buffer by flush()
+ * @note Word stores may overwrite bytes of the buffer past the current position of the writer
+ *
+ * @tparam Order
+ *    order of bits in the stream
+ */
+template<bit_order Order = bit_order::lsb_first>
+class bit_writer {
+
+public: /* ---------------------------------------------------- Public constants -------------------------------------------------- */
+
+    /// Order of bits in the stream
+    static constexpr bit_order order = Order;
+
+public: /* ------------------------------------------------------ Public ctors ---------------------------------------------------- */
+
+    /**
+     * @brief Constructs the writer of the @p size bytes of @p data
+     */
+    constexpr bit_writer(uint8_t *data, std::size_t size) noexcept;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Writes @p N LSBits of @p value into the stream
+     */
+    template<std::size_t N>
+        requires (N <= doubleword_bitsize)
+    constexpr void write(uint64_t value) noexcept;
+
+    /**
+     * @brief Writes @p nbits LSBits of @p value into the stream
+     */
+    constexpr void write(uint64_t value, std::size_t nbits) noexcept;
+
+    /**
+     * @brief Writes zero bits up to the next byte boundary
+     */
+    constexpr void align() noexcept;
+
+    /**
+     * @brief Writes all bits held by the writer into the buffer (the last byte is zero-padded)
+     * @returns
+     *    number of bytes of the buffer written so far
+     */
+    constexpr std::size_t flush() noexcept;
+
+    /**
+     * @returns
+     *    number of bits written into the stream
+     */
+    constexpr std::size_t position() const noexcept;
+
+    /**
+     * @returns
+     *    @c true if more bits has been written than the buffer can hold
+     */
+    constexpr bool overrun() const noexcept;
+
+private: /* ---------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /// Stores all full bytes of the accumulator into the buffer
+    constexpr void drain() noexcept;
+
+    /// Appends @p nbits ( @p nbits <= 56 ) LSBits of @p value to the accumulator
+    constexpr void append(uint64_t value, std::size_t nbits) noexcept;
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Beginning of the buffer
+    uint8_t *begin;
+    /// Next byte of the buffer to be stored
+    uint8_t *next;
+    /// End of the buffer
+    uint8_t *end;
+    /// Number of bytes discarded past the end of the buffer
+    std::size_t discarded { 0 };
+    /// Accumulator
+    uint64_t acc { 0 };
+    /// Number of valid bits in the accumulator
+    std::size_t count { 0 };
+
+};
+
+/* ========================================================= Frame layout ========================================================= */
+
+namespace details {
+
+    /// Helper trait providing tuple of values described by the frame's field
+    template<typename Field>
+    struct bit_field_values;
+
+}
+
+/**
+ * @brief Description of the bit field of the frame
+ * @details Fields of signed integral types are sign-extended, fields of enumeration types are converted
+ *    from their underlying type
+ *
+ * @tparam T
+ *    type of the field's value (integral, enum or bool)
+ * @tparam Bits
+ *    size of the field in bits
+ */
+template<typename T, std::size_t Bits = sizeof(T) * byte_bitsize>
+    requires ((std::is_integral_v<T> or std::is_enum_v<T>) and (Bits > 0) and (Bits <= doubleword_bitsize))
+struct bit_field {
+
+    /// Type of the field's value
+    using value_type = T;
+
+    /// Size of the field
+    static constexpr std::size_t bitsize = Bits;
+
+};
+
+/**
+ * @brief Description of the unused bits of the frame (skipped when decoding, zeroed when encoding)
+ *
+ * @tparam Bits
+ *    number of bits
+ */
+template<std::size_t Bits>
+struct bit_padding {
+
+    /// Size of the padding
+    static constexpr std::size_t bitsize = Bits;
+
+};
+
+/**
+ * @brief Compile-time description of the bit-packed frame consisting of @p Fields . Decoders and
+ *    encoders of the frame are generated as a fully unrolled sequence of reader/writer calls
+ *
+ * @tparam Fields
+ *    specializations of bit_field and bit_padding templates
+ */
+template<typename... Fields>
+struct bit_layout {
+
+    /// Size of the frame in bits
+    static constexpr std::size_t bitsize = (Fields::bitsize + ... + 0);
+
+    /// Size of the frame in bytes
+    static constexpr std::size_t size = (bitsize + byte_bitsize - 1) / byte_bitsize;
+
+    /// Tuple of values of all fields of the frame (paddings excluded)
+    using tuple_type = decltype(std::tuple_cat(std::declval<typename details::bit_field_values<Fields>::type>()...));
+
+    /**
+     * @brief Decodes the frame from the @p reader
+     * @returns
+     *    tuple of values of subsequent fields of the frame
+     */
+    template<bit_order Order>
+    static constexpr tuple_type decode(bit_reader<Order> &reader) noexcept;
+
+    /**
+     * @brief Decodes the frame from the @p reader into the aggregate of type @p T whose members
+     *    correspond to subsequent fields of the frame
+     * @returns
+     *    decoded aggregate
+     */
+    template<typename T, bit_order Order>
+    static constexpr T decode_as(bit_reader<Order> &reader) noexcept;
+
+    /**
+     * @brief Encodes the frame described with @p values of subsequent fields into the @p writer
+     */
+    template<bit_order Order>
+    static constexpr void encode(bit_writer<Order> &writer, const tuple_type &values) noexcept;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/bit/bit_stream.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
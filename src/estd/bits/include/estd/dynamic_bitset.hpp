@@ -0,0 +1,295 @@
+/* ============================================================================================================================ *//**
+ * @file       dynamic_bitset.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 3:58:21 am
+ * @modified   Monday, 19th October 2026 3:58:21 am
+ * @project    cpp-utils
+ * @brief      Definition of the dynamic_bitset class - runtime-sized bitmap with hierarchical summaries and rank/select
+ *             support
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_DYNAMIC_BITSET_H__
+#define __ESTD_DYNAMIC_BITSET_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstdint>
+#include <limits>
+#include <vector>
+// Private includes
+#include "estd/bit.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* =========================================================== Summary ============================================================ */
+
+namespace details {
+
+    /**
+     * @brief Hierarchy of bitmaps summarizing the array of 64-bit words. Bit @a i of the lowest level
+     *    marks the @a i word of the summarized array, bit @a j of each higher level is set if the
+     *    @a j word of the level below is non-zero. Levels are added until a level fits a single word,
+     *    so that lookups take O(log64 N) steps
+     */
+    class bitmap_summary {
+
+    public: /* ------------------------------------------------ Public constants ------------------------------------------------ */
+
+        /// Value returned by lookups if no marked index is found
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    public: /* ------------------------------------------------- Public methods ------------------------------------------------- */
+
+        /**
+         * @brief Rebuilds the summary of @p n words marking the @a i word if @p marked(i) is @c true
+         */
+        template<typename Predicate>
+        void build(std::size_t n, Predicate &&marked);
+
+        /**
+         * @brief Marks the @p i word
+         */
+        inline void mark(std::size_t i) noexcept;
+
+        /**
+         * @brief Unmarks the @p i word
+         */
+        inline void unmark(std::size_t i) noexcept;
+
+        /**
+         * @returns
+         *    @c true if any word is marked
+         */
+        inline bool any() const noexcept;
+
+        /**
+         * @returns
+         *    index of the first marked word not lower than @p i or @ref npos if there is no such word
+         */
+        inline std::size_t find_from(std::size_t i) const noexcept;
+
+    private: /* ------------------------------------------------- Private data -------------------------------------------------- */
+
+        /// Levels of the summary (starting from the one summarizing the words)
+        std::vector<std::vector<uint64_t>> levels;
+
+    };
+
+}
+
+/* ======================================================== Dynamic bitset ======================================================== */
+
+/**
+ * @brief Runtime-sized bitset stored in 64-bit words. Besides the bits themselves, the set maintains
+ *    two hierarchical summaries (of non-empty and non-full words) which make find_first_set() and
+ *    find_first_clear() (as well as their find_next_* counterparts) take O(log64 N) steps instead of
+ *    scanning the whole set. This makes the set suitable e.g. for tracking free slots of large pools
+ * @details Single-bit modifications update summaries in O(log64 N) (typically O(1) as propagation stops
+ *    at the first level that does not change). rank() and select() may optionally be accelerated with
+ *    the index built by build_rank_index(). The index is invalidated by any modification of the set
+ *    (the queries remain valid, falling back to the linear scan)
+ */
+class dynamic_bitset {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the storage word
+    using word_type = uint64_t;
+
+public: /* --------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Number of bits in the storage word
+    static constexpr std::size_t word_bitsize = sizeof(word_type) * byte_bitsize;
+
+    /// Value returned by lookups if no matching bit is found
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    /// Number of words covered by a single entry of the rank index
+    static constexpr std::size_t rank_block_words = 8;
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /**
+     * @brief Constructs the set of @p size bits initialized to @p value
+     */
+    inline explicit dynamic_bitset(std::size_t size = 0, bool value = false);
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    number of bits in the set
+     */
+    std::size_t size() const noexcept { return bits; }
+
+    /**
+     * @brief Resizes the set to @p size bits. Newly added bits are initialized to @p value
+     */
+    inline void resize(std::size_t size, bool value = false);
+
+    /**
+     * @returns
+     *    value of the @p pos bit
+     */
+    inline bool test(std::size_t pos) const noexcept;
+
+    /**
+     * @brief Sets the @p pos bit to @p value
+     */
+    inline void set(std::size_t pos, bool value = true) noexcept;
+
+    /**
+     * @brief Sets all bits of the set
+     */
+    inline void set();
+
+    /**
+     * @brief Clears the @p pos bit
+     */
+    inline void reset(std::size_t pos) noexcept;
+
+    /**
+     * @brief Clears all bits of the set
+     */
+    inline void reset();
+
+    /**
+     * @brief Flips the @p pos bit
+     */
+    inline void flip(std::size_t pos) noexcept;
+
+    /**
+     * @returns
+     *    number of set bits
+     */
+    inline std::size_t count() const noexcept;
+
+    /**
+     * @returns
+     *    @c true if any bit is set
+     */
+    inline bool any() const noexcept;
+
+    /**
+     * @returns
+     *    @c true if no bit is set
+     */
+    inline bool none() const noexcept;
+
+    /**
+     * @returns
+     *    @c true if all bits are set
+     */
+    inline bool all() const noexcept;
+
+    /**
+     * @returns
+     *    index of the first set bit or @ref npos if no bit is set
+     */
+    inline std::size_t find_first_set() const noexcept;
+
+    /**
+     * @returns
+     *    index of the first clear bit or @ref npos if all bits are set
+     */
+    inline std::size_t find_first_clear() const noexcept;
+
+    /**
+     * @returns
+     *    index of the first set bit following the @p pos bit or @ref npos if there is no such bit
+     */
+    inline std::size_t find_next_set(std::size_t pos) const noexcept;
+
+    /**
+     * @returns
+     *    index of the first clear bit following the @p pos bit or @ref npos if there is no such bit
+     */
+    inline std::size_t find_next_clear(std::size_t pos) const noexcept;
+
+    /**
+     * @brief Builds the index accelerating rank() and select() (one counter per @ref rank_block_words
+     *    words of the set)
+     */
+    inline void build_rank_index();
+
+    /**
+     * @returns
+     *    @c true if the rank index is up to date
+     */
+    bool has_rank_index() const noexcept { return rank_valid; }
+
+    /**
+     * @returns
+     *    number of set bits in the range [0, @p pos )
+     */
+    inline std::size_t rank(std::size_t pos) const noexcept;
+
+    /**
+     * @returns
+     *    index of the @p k (counting from 0) set bit or @ref npos if there is less than @p k + 1 set bits
+     */
+    inline std::size_t select(std::size_t k) const noexcept;
+
+    /**
+     * @returns
+     *    pointer to the storage words (bit @a i is stored in the (i % 64) bit of the (i / 64) word)
+     */
+    const word_type *data() const noexcept { return words.data(); }
+
+private: /* ---------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /// Returns mask of valid bits of the @p i word
+    inline word_type valid_mask(std::size_t i) const noexcept;
+
+    /// Rebuilds summaries and invalidates the rank index
+    inline void rebuild();
+
+    /// Updates summaries after modification of the @p i word from @p previous value
+    inline void update(std::size_t i, word_type previous) noexcept;
+
+    /// Returns index of the first set bit not lower than @p pos
+    inline std::size_t find_set_from(std::size_t pos) const noexcept;
+
+    /// Returns index of the first clear bit not lower than @p pos
+    inline std::size_t find_clear_from(std::size_t pos) const noexcept;
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Number of bits of the set
+    std::size_t bits { 0 };
+
+    /// Storage words (bits past the size of the set are kept cleared)
+    std::vector<word_type> words;
+
+    /// Summary of non-empty words
+    details::bitmap_summary set_summary;
+
+    /// Summary of non-full words
+    details::bitmap_summary clear_summary;
+
+    /// Number of set bits preceding each block of @ref rank_block_words words
+    std::vector<std::size_t> rank_blocks;
+
+    /// Validity of the rank index
+    bool rank_valid { false };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/bit/dynamic_bitset.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
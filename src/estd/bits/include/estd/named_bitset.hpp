@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Thursday, 2nd June 2022 12:53:22 pm
- * @modified   Tuesday, 28th February 2023 8:41:24 pm
+ * @modified   Monday, 19th October 2026 3:10:44 am
  * @project    cpp-utils
  * @brief      Definition of the named_bitset class template extending std::bitset with capability to be indexed ([] operator)
  *             with enum class values
@@ -209,6 +209,24 @@ constexpr auto operator&(Int i, Enum e) {
     header ESTD_NAMED_BITSET_WRAP_BITSET_BINARY_OPERATOR(&, baseclass, targetclass);            \
     header ESTD_NAMED_BITSET_WRAP_BITSET_BINARY_OPERATOR(^, baseclass, targetclass)
 
+/* ======================================================== Set bits range ======================================================== */
+
+namespace details {
+
+    /**
+     * @brief Forward iterator over indices of set bits of the std::bitset yielding them as @p Value
+     */
+    template<std::size_t N, typename Value>
+    class set_bits_iterator;
+
+    /**
+     * @brief Range of indices of set bits of the std::bitset yielding them as @p Value
+     */
+    template<std::size_t N, typename Value>
+    class set_bits_range;
+
+}
+
 /* ========================================================= Named bitset ========================================================= */
 
 /**
@@ -250,9 +268,6 @@ public: /* ----------------------------------------------------- Public ctors --
         std::bitset<N>{ std::underlying_type_t<Enum>(1) << estd::to_underlying(e) }
     { }
 
-    // Forward basic constructors
-    using std::bitset<N>::bitset;
-
 public: /* --------------------------------------------------- Public operators -------------------------------------------------- */
 
     /// Wrap basic member operator of the bitset
@@ -406,7 +421,63 @@ public: /* ---------------------------------------------------- Public methods -
 
         return t;
     }
-    
+
+public: /* ------------------------------------------------- Public methods (bits scanning) ----------------------------------------- */
+
+    /**
+     * @returns 
+     *    number of set bits
+     * @note Bitset is processed word by word (using AVX2 for large sets, if enabled at compile time)
+     */
+    std::size_t count() const noexcept;
+
+    /**
+     * @returns 
+     *    @c true if any bit of the set is set
+     */
+    bool any() const noexcept;
+
+    /**
+     * @returns 
+     *    @c true if no bit of the set is set
+     */
+    bool none() const noexcept;
+
+    /**
+     * @returns 
+     *    index of the first set bit or @p N if no bit is set
+     */
+    std::size_t find_first() const noexcept;
+
+    /**
+     * @returns 
+     *    index of the first set bit following the @p pos bit or @p N if there is no such bit
+     */
+    std::size_t find_next(std::size_t pos) const noexcept;
+
+    /**
+     * @brief Calls @p f for each set bit in the ascending order
+     * 
+     * @tparam Value 
+     *    type of the argument passed to @p f (index of the bit or enumeration)
+     * @param f 
+     *    callable invoked with index of the bit casted to @p Value
+     */
+    template<typename Value = std::size_t, typename F>
+        requires (std::is_integral_v<Value> or std::is_enum_v<Value>)
+    void for_each_set(F &&f) const;
+
+    /**
+     * @returns 
+     *    range of indices of set bits (ascending) casted to @p Value
+     * 
+     * @tparam Value 
+     *    type of the value yielded by the range (index of the bit or enumeration)
+     */
+    template<typename Value = std::size_t>
+        requires (std::is_integral_v<Value> or std::is_enum_v<Value>)
+    details::set_bits_range<N, Value> set_bits() const noexcept;
+
 };
 
 /// Wrap binary operators of the bitset
@@ -416,6 +487,10 @@ ESTD_NAMED_BITSET_WRAP_BITSET_BINARY_OPERATORS_TEMPLATE(template<std::size_t N>,
 
 } // End namespace estd
 
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/bit/named_bitset.hpp"
+
 /* ================================================================================================================================ */
 
 #endif
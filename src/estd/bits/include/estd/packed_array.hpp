@@ -0,0 +1,278 @@
+/* ============================================================================================================================ *//**
+ * @file       packed_array.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:04:12 am
+ * @modified   Monday, 19th October 2026 1:04:12 am
+ * @project    cpp-utils
+ * @brief      Definitions of containers of unsigned integers stored contiguously at the fixed bit width
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_PACKED_ARRAY_H__
+#define __ESTD_PACKED_ARRAY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+// Private includes
+#include "estd/bit.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace details {
+
+    /// The smallest unsigned integral type holding @p Bits bits
+    template<std::size_t Bits>
+    using packed_value_t =
+        std::conditional_t<(Bits <= byte_bitsize),     uint8_t,
+        std::conditional_t<(Bits <= halfword_bitsize), uint16_t,
+        std::conditional_t<(Bits <= word_bitsize),     uint32_t,
+                                                       uint64_t>>>;
+
+    /**
+     * @returns
+     *    number of 64-bit words required to store @p n elements of @p Bits bits (including a trailing
+     *    padding word that makes accesses to any element touch exactly two words)
+     */
+    template<std::size_t Bits>
+    constexpr std::size_t packed_words(std::size_t n) noexcept;
+
+    /**
+     * @brief Proxy class representing reference to the element of the packed container
+     */
+    template<std::size_t Bits>
+    class packed_reference {
+
+    public: /* ------------------------------------------------- Public types ------------------------------------------------- */
+
+        /// Type of the element
+        using value_type = packed_value_t<Bits>;
+
+    public: /* ------------------------------------------------- Public ctors ------------------------------------------------- */
+
+        /// Constructs reference to the @p index element stored in @p words
+        constexpr packed_reference(uint64_t *words, std::size_t index) noexcept;
+
+    public: /* ------------------------------------------------ Public operators ---------------------------------------------- */
+
+        /// Writes @p value to the referenced element
+        constexpr packed_reference &operator=(value_type value) noexcept;
+
+        /// Writes value of the @p other element to the referenced element
+        constexpr packed_reference &operator=(const packed_reference &other) noexcept;
+
+        /// Reads the referenced element
+        constexpr operator value_type() const noexcept;
+
+    private: /* ------------------------------------------------- Private data ------------------------------------------------ */
+
+        /// Storage of the container
+        uint64_t *words;
+        /// Index of the element
+        std::size_t index;
+
+    };
+
+}
+
+/* ========================================================= Packed array ========================================================= */
+
+/**
+ * @brief Fixed-size array of @p N unsigned integers stored contiguously at @p Bits bits each
+ * @details Element @a i occupies bits [i * Bits, (i + 1) * Bits) of the array of 64-bit words
+ *    (counting from the LSBit of the first word). Single-element accesses are branchless and
+ *    touch at most two words. Bulk unpack() uses AVX2 gathers (if enabled at compile time)
+ *    for widths up to 25 bits
+ *
+ * @tparam Bits
+ *    width of the element in bits
+ * @tparam N
+ *    number of elements
+ */
+template<std::size_t Bits, std::size_t N>
+    requires ((Bits > 0) and (Bits <= 64))
+class packed_array {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the element (the smallest unsigned integral type holding @p Bits bits)
+    using value_type = details::packed_value_t<Bits>;
+
+    /// Type of the proxy reference to the element
+    using reference = details::packed_reference<Bits>;
+
+public: /* --------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Width of the element in bits
+    static constexpr std::size_t bitsize = Bits;
+
+    /// Number of words of the storage
+    static constexpr std::size_t words = details::packed_words<Bits>(N);
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Constructs the array of zeros
+    constexpr packed_array() = default;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /// @returns number of elements
+    static constexpr std::size_t size() noexcept { return N; }
+
+    /// @returns value of the @p index element
+    constexpr value_type get(std::size_t index) const noexcept;
+
+    /// Sets the @p index element to LSBits of @p value
+    constexpr void set(std::size_t index, value_type value) noexcept;
+
+    /// Sets all elements to LSBits of @p value
+    constexpr void fill(value_type value) noexcept;
+
+    /**
+     * @brief Copies @p count elements starting from the @p first one into the native array @p dst
+     */
+    void unpack(std::size_t first, std::size_t count, value_type *dst) const noexcept;
+
+    /**
+     * @brief Sets @p count elements starting from the @p first one to values of the native array @p src
+     */
+    void pack(std::size_t first, std::size_t count, const value_type *src) noexcept;
+
+    /// @returns pointer to the underlying storage
+    constexpr uint64_t *data() noexcept { return storage.data(); }
+
+    /// @returns pointer to the underlying storage
+    constexpr const uint64_t *data() const noexcept { return storage.data(); }
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    /// @returns value of the @p index element
+    constexpr value_type operator[](std::size_t index) const noexcept;
+
+    /// @returns proxy reference to the @p index element
+    constexpr reference operator[](std::size_t index) noexcept;
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Storage
+    std::array<uint64_t, words> storage { };
+
+};
+
+/* ========================================================= Packed vector ======================================================== */
+
+/**
+ * @brief Dynamically-sized counterpart of the packed_array
+ *
+ * @tparam Bits
+ *    width of the element in bits
+ */
+template<std::size_t Bits>
+    requires ((Bits > 0) and (Bits <= 64))
+class packed_vector {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the element (the smallest unsigned integral type holding @p Bits bits)
+    using value_type = details::packed_value_t<Bits>;
+
+    /// Type of the proxy reference to the element
+    using reference = details::packed_reference<Bits>;
+
+public: /* --------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Width of the element in bits
+    static constexpr std::size_t bitsize = Bits;
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Constructs an empty vector
+    packed_vector() = default;
+
+    /// Constructs vector of @p n elements set to LSBits of @p value
+    explicit packed_vector(std::size_t n, value_type value = 0);
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /// @returns number of elements
+    std::size_t size() const noexcept { return count; }
+
+    /// @returns @c true if vector holds no elements
+    bool empty() const noexcept { return count == 0; }
+
+    /// @returns number of elements that can be held without reallocation
+    std::size_t capacity() const noexcept;
+
+    /// Reserves storage for @p n elements
+    void reserve(std::size_t n);
+
+    /// Resizes vector to @p n elements (new elements are set to LSBits of @p value )
+    void resize(std::size_t n, value_type value = 0);
+
+    /// Removes all elements
+    void clear() noexcept;
+
+    /// Appends LSBits of @p value at the end of the vector
+    void push_back(value_type value);
+
+    /// @returns value of the @p index element
+    value_type get(std::size_t index) const noexcept;
+
+    /// Sets the @p index element to LSBits of @p value
+    void set(std::size_t index, value_type value) noexcept;
+
+    /**
+     * @brief Copies @p n elements starting from the @p first one into the native array @p dst
+     */
+    void unpack(std::size_t first, std::size_t n, value_type *dst) const noexcept;
+
+    /**
+     * @brief Sets @p n elements starting from the @p first one to values of the native array @p src
+     */
+    void pack(std::size_t first, std::size_t n, const value_type *src) noexcept;
+
+    /// @returns pointer to the underlying storage
+    uint64_t *data() noexcept { return storage.data(); }
+
+    /// @returns pointer to the underlying storage
+    const uint64_t *data() const noexcept { return storage.data(); }
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    /// @returns value of the @p index element
+    value_type operator[](std::size_t index) const noexcept;
+
+    /// @returns proxy reference to the @p index element
+    reference operator[](std::size_t index) noexcept;
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Storage
+    std::vector<uint64_t> storage;
+    /// Number of elements
+    std::size_t count { 0 };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/bit/packed_array.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,145 @@
+/* ============================================================================================================================ *//**
+ * @file       varint.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:47:30 am
+ * @modified   Monday, 19th October 2026 1:47:30 am
+ * @project    cpp-utils
+ * @brief      Definitions of the variable-length integers (unsigned LEB128) codec with zigzag mapping of signed values
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_VARINT_H__
+#define __ESTD_VARINT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstdint>
+#include <type_traits>
+// Private includes
+#include "estd/bit.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* =========================================================== Constants ========================================================== */
+
+/// Maximal size of the encoded 64-bit varint in bytes
+inline constexpr std::size_t varint_max_size = 10;
+
+/* ============================================================= Types ============================================================ */
+
+/**
+ * @brief Result of the batch varint decoding
+ */
+struct varint_batch_result {
+
+    /// Number of decoded values
+    std::size_t values;
+
+    /// Number of consumed bytes
+    std::size_t bytes;
+
+};
+
+/* =========================================================== Functions ========================================================== */
+
+/**
+ * @brief Maps signed @p value into the unsigned one so that values of small magnitude are mapped to
+ *    small numbers (0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...)
+ */
+template<typename T>
+    requires (std::is_integral_v<T> and std::is_signed_v<T>)
+constexpr std::make_unsigned_t<T> zigzag_encode(T value) noexcept;
+
+/**
+ * @brief Inverse of the zigzag_encode()
+ */
+template<typename T>
+    requires (std::is_integral_v<T> and std::is_unsigned_v<T>)
+constexpr std::make_signed_t<T> zigzag_decode(T value) noexcept;
+
+/**
+ * @returns
+ *    number of bytes of the varint encoding @p value
+ */
+constexpr std::size_t varint_size(uint64_t value) noexcept;
+
+/**
+ * @brief Encodes @p value as a varint
+ *
+ * @param value
+ *    value to be encoded
+ * @param dst
+ *    destination buffer (at least varint_size( @p value ) bytes)
+ * @returns
+ *    number of written bytes
+ */
+constexpr std::size_t encode_varint(uint64_t value, uint8_t *dst) noexcept;
+
+/**
+ * @brief Decodes a single varint
+ *
+ * @param src
+ *    source buffer
+ * @param size
+ *    size of the source buffer
+ * @param[out] value
+ *    decoded value
+ * @returns
+ *    number of consumed bytes or @c 0 if @p src holds truncated or overlong (wider than 64 bits) varint
+ */
+constexpr std::size_t decode_varint(const uint8_t *src, std::size_t size, uint64_t &value) noexcept;
+
+/**
+ * @brief Encodes @p count values of @p src as subsequent varints
+ * @note Values are encoded with a single 64-bit store each while at least 8 bytes of @p dst are left
+ *    (bytes of @p dst past the encoded data may be overwritten)
+ *
+ * @param src
+ *    values to be encoded
+ * @param count
+ *    number of values
+ * @param dst
+ *    destination buffer
+ * @param size
+ *    size of the destination buffer
+ * @returns
+ *    number of encoded values and written bytes (encoding stops at the first value that does not fit @p dst )
+ */
+inline varint_batch_result encode_varints(const uint64_t *src, std::size_t count, uint8_t *dst, std::size_t size) noexcept;
+
+/**
+ * @brief Decodes up to @p count subsequent varints
+ * @details Decoder finds lengths of varints with the mask of continuation bits of the 8-byte word
+ *    and gathers 7-bit groups with SWAR shifts (or PEXT if BMI2 is enabled at compile time). Runs of
+ *    single-byte varints are expanded with AVX2 (if enabled at compile time)
+ *
+ * @param src
+ *    source buffer
+ * @param size
+ *    size of the source buffer
+ * @param dst
+ *    destination buffer
+ * @param count
+ *    maximal number of decoded values
+ * @returns
+ *    number of decoded values and consumed bytes (decoding stops at the first malformed varint)
+ */
+inline varint_batch_result decode_varints(const uint8_t *src, std::size_t size, uint64_t *dst, std::size_t count) noexcept;
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/bit/varint.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,64 @@
+/* ============================================================================================================================ *//**
+ * @file       enum_array.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 5:20:37 am
+ * @modified   Monday, 19th October 2026 5:20:37 am
+ * @project    cpp-utils
+ * @brief      Implementation of the enum_array class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_ENUM_IMPL_ENUM_ARRAY_H__
+#define __ESTD_ENUM_IMPL_ENUM_ARRAY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include "estd/enum_array.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================= Public ctors ========================================================= */
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+constexpr enum_array<Enum, T, Min, Max>::enum_array(const T &value) {
+    fill(value);
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+constexpr void enum_array<Enum, T, Min, Max>::fill(const T &value) {
+    for(auto &element : storage)
+        element = value;
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+template<typename F>
+constexpr void enum_array<Enum, T, Min, Max>::for_each(F &&f) {
+    for(size_type i = 0; i < extent; ++i)
+        f(key(i), storage[i]);
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+template<typename F>
+constexpr void enum_array<Enum, T, Min, Max>::for_each(F &&f) const {
+    for(size_type i = 0; i < extent; ++i)
+        f(key(i), storage[i]);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
@@ -0,0 +1,256 @@
+/* ============================================================================================================================ *//**
+ * @file       enum_map.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 5:20:37 am
+ * @modified   Monday, 19th October 2026 8:19:30 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the enum_map class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_ENUM_IMPL_ENUM_MAP_H__
+#define __ESTD_ENUM_IMPL_ENUM_MAP_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include "estd/enum_map.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* =========================================================== Iterator =========================================================== */
+
+namespace details {
+
+    template<typename Map, typename Value>
+    class enum_map_iterator {
+
+    public: /* ------------------------------------------------- Public types ------------------------------------------------- */
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<typename std::remove_const_t<Map>::key_type, Value&>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = value_type;
+
+    public: /* ------------------------------------------------- Public ctors ------------------------------------------------- */
+
+        enum_map_iterator() = default;
+
+        enum_map_iterator(Map *map, std::size_t i) noexcept :
+            map{ map },
+            i{ i }
+        { }
+
+        /// Converts mutable iterator to the constant one
+        template<typename OtherMap, typename OtherValue>
+            requires (std::is_same_v<const OtherMap, Map> and std::is_same_v<const OtherValue, Value>)
+        enum_map_iterator(const enum_map_iterator<OtherMap, OtherValue> &other) noexcept :
+            map{ other.map },
+            i{ other.i }
+        { }
+
+    public: /* ----------------------------------------------- Public operators ----------------------------------------------- */
+
+        reference operator*() const noexcept {
+            return reference{ std::remove_const_t<Map>::key(i), map->element(i) };
+        }
+
+        enum_map_iterator &operator++() noexcept {
+            i = map->next(i + 1);
+            return *this;
+        }
+
+        enum_map_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const enum_map_iterator &other) const noexcept {
+            return i == other.i;
+        }
+
+    private: /* ------------------------------------------------ Private data ------------------------------------------------- */
+
+        template<typename OtherMap, typename OtherValue>
+        friend class enum_map_iterator;
+
+        /// Iterated map
+        Map *map { nullptr };
+        /// Index of the current element
+        std::size_t i { 0 };
+
+    };
+
+}
+
+/* ========================================================= Public ctors ========================================================= */
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+enum_map<Enum, T, Min, Max>::enum_map(const enum_map &other) :
+    // Once the delegated constructor completes, the destructor cleans up elements if one of the copies throws
+    enum_map()
+{
+    other.for_each([this](Enum key, const T &value) { emplace(key, value); });
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+enum_map<Enum, T, Min, Max>::enum_map(enum_map &&other) noexcept(std::is_nothrow_move_constructible_v<T>) :
+    enum_map()
+{
+    other.for_each([this](Enum key, T &value) { emplace(key, std::move(value)); });
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+enum_map<Enum, T, Min, Max> &enum_map<Enum, T, Min, Max>::operator=(const enum_map &other) {
+
+    if(this != &other) {
+        clear();
+        other.for_each([this](Enum key, const T &value) { emplace(key, value); });
+    }
+
+    return *this;
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+enum_map<Enum, T, Min, Max> &enum_map<Enum, T, Min, Max>::operator=(enum_map &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+
+    if(this != &other) {
+        clear();
+        other.for_each([this](Enum key, T &value) { emplace(key, std::move(value)); });
+    }
+
+    return *this;
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+enum_map<Enum, T, Min, Max>::~enum_map() {
+    clear();
+}
+
+/* ======================================================= Public operators ======================================================= */
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+T &enum_map<Enum, T, Min, Max>::operator[](Enum key) {
+    return (*emplace(key).first).second;
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+template<typename... Args>
+std::pair<typename enum_map<Enum, T, Min, Max>::iterator, bool> enum_map<Enum, T, Min, Max>::emplace(Enum key, Args&&... args) {
+
+    size_type i = index(key);
+
+    if(present.test(i))
+        return { iterator{ this, i }, false };
+
+    new (slots[i].bytes) T(std::forward<Args>(args)...);
+
+    present.set(i);
+    ++elements;
+
+    return { iterator{ this, i }, true };
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+template<typename U>
+std::pair<typename enum_map<Enum, T, Min, Max>::iterator, bool> enum_map<Enum, T, Min, Max>::insert_or_assign(Enum key, U &&value) {
+
+    size_type i = index(key);
+
+    if(present.test(i)) {
+        element(i) = std::forward<U>(value);
+        return { iterator{ this, i }, false };
+    }
+
+    return emplace(key, std::forward<U>(value));
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+typename enum_map<Enum, T, Min, Max>::size_type enum_map<Enum, T, Min, Max>::erase(Enum key) noexcept {
+
+    if(not contains(key))
+        return 0;
+
+    size_type i = index(key);
+
+    element(i).~T();
+
+    present.reset(i);
+    --elements;
+
+    return 1;
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+void enum_map<Enum, T, Min, Max>::clear() noexcept {
+
+    if constexpr (not std::is_trivially_destructible_v<T>) {
+        for(size_type i = first(); i < extent; i = next(i + 1))
+            element(i).~T();
+    }
+
+    present.reset();
+    elements = 0;
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+template<typename F>
+void enum_map<Enum, T, Min, Max>::for_each(F &&f) {
+    for(size_type i = first(); i < extent; i = next(i + 1))
+        f(key(i), element(i));
+}
+
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+template<typename F>
+void enum_map<Enum, T, Min, Max>::for_each(F &&f) const {
+    for(size_type i = first(); i < extent; i = next(i + 1))
+        f(key(i), element(i));
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+template<typename Enum, typename T, Enum Min, Enum Max>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+typename enum_map<Enum, T, Min, Max>::size_type enum_map<Enum, T, Min, Max>::next(size_type i) const noexcept {
+
+    // Skip absent elements
+    while(i < extent and not present.test(i))
+        ++i;
+
+    return i;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
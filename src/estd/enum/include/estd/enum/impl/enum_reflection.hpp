@@ -0,0 +1,401 @@
+/* ============================================================================================================================ *//**
+ * @file       enum_reflection.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 4:41:09 am
+ * @modified   Monday, 19th October 2026 10:34:15 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the compile-time reflection of enumerations
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_ENUM_IMPL_ENUM_REFLECTION_H__
+#define __ESTD_ENUM_IMPL_ENUM_REFLECTION_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <utility>
+// Private includes
+#include "estd/enum_reflection.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ======================================================== Implementation ======================================================== */
+
+namespace details {
+
+    /**
+     * @brief Obtains signature of the function specialized for the @p V enumerated constant (the constant
+     *    is printed as the name of the enumerator if @p V names one or as the casted integer otherwise)
+     */
+    template<auto V>
+    constexpr std::string_view enum_value_signature() noexcept {
+    #if defined(_MSC_VER) and not defined(__clang__)
+        return __FUNCSIG__;
+    #else
+        return __PRETTY_FUNCTION__;
+    #endif
+    }
+
+    /**
+     * @returns
+     *    @c true if @p name is a valid identifier
+     */
+    constexpr bool enum_identifier(std::string_view name) noexcept {
+
+        auto identifier_char = [](char c) {
+            return (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z') or (c >= '0' and c <= '9') or c == '_';
+        };
+
+        if(name.empty() or (name[0] >= '0' and name[0] <= '9'))
+            return false;
+
+        for(char c : name)
+            if(not identifier_char(c))
+                return false;
+
+        return true;
+    }
+
+    /**
+     * @brief Parses result of @ref enum_value_signature() to obtain unqualified name of the @p V enumerator
+     * @returns
+     *    name of the enumerator or empty string if @p V does not name an enumerator
+     */
+    template<auto V>
+    constexpr std::string_view enum_value_name() noexcept {
+
+        constexpr std::string_view signature = enum_value_signature<V>();
+
+    #if defined(_MSC_VER) and not defined(__clang__)
+        // ... enum_value_signature<ns::color::red>(void) noexcept
+        constexpr std::size_t begin = signature.find("enum_value_signature<") + sizeof("enum_value_signature<") - 1;
+        constexpr std::size_t end   = signature.rfind(">(");
+    #else
+        // GCC : ... [with auto V = ns::color::red; std::string_view = ...]
+        // Clang: ... [V = ns::color::red]
+        constexpr std::size_t begin = signature.find("V = ") + sizeof("V = ") - 1;
+        constexpr std::size_t end   = signature.find_first_of(";]", begin);
+    #endif
+
+        constexpr std::string_view value = signature.substr(begin, end - begin);
+
+        /**
+         * Enumerators are printed as qualified names whose scope may itself contain non-identifier
+         * characters (e.g. '(anonymous namespace)::color::red' from Clang), so only the part after
+         * the last '::' is inspected. Values not naming enumerators are printed as casts (e.g.
+         * '(ns::color)5') whose last part is never an identifier
+         */
+        constexpr std::size_t scope = value.rfind("::");
+        constexpr std::string_view name = (scope == std::string_view::npos) ? value : value.substr(scope + 2);
+
+        if constexpr (not enum_identifier(name))
+            return { };
+        else
+            return name;
+    }
+
+    /**
+     * @brief Obtains names of all values of the @ref enum_range of @p Enum (empty for values not naming enumerators)
+     */
+    template<typename Enum, std::size_t... I>
+    constexpr auto enum_range_names(std::index_sequence<I...>) noexcept {
+
+        using underlying = std::underlying_type_t<Enum>;
+
+        return std::array<std::string_view, sizeof...(I)>{
+            enum_value_name<static_cast<Enum>(static_cast<underlying>(enum_range<Enum>::min + static_cast<long long>(I)))>()...
+        };
+    }
+
+    /**
+     * @brief Seeded FNV-1a hash of @p name used by the perfect hash of enumerators' names
+     */
+    constexpr uint64_t enum_name_hash(std::string_view name, uint64_t seed) noexcept {
+
+        uint64_t hash = 0xCBF29CE484222325ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+
+        for(char c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001B3ULL;
+        }
+
+        return hash ^ (hash >> 32);
+    }
+
+    /**
+     * @brief Perfect hash of @p N names built with the hash-and-displace method. Each name is assigned to
+     *    the bucket by the hash with seed 0. Names of each bucket are placed in the table with the per-bucket
+     *    seed chosen so that they do not collide with names placed so far (largest buckets first)
+     */
+    template<std::size_t N>
+    struct enum_names_perfect_hash {
+
+        /// Number of buckets
+        static constexpr std::size_t buckets = std::bit_ceil(N == 0 ? std::size_t(1) : N);
+
+        /// Number of slots of the table (load factor <= 0.5)
+        static constexpr std::size_t slots = 2 * buckets;
+
+        /// Per-bucket seeds
+        std::array<uint32_t, buckets> seeds { };
+
+        /// Slots of the table holding indices of names increased by 1 (0 for empty slots)
+        std::array<uint16_t, slots> table { };
+
+        constexpr enum_names_perfect_hash(const std::array<std::string_view, N> &names) {
+
+            static_assert(N < std::numeric_limits<uint16_t>::max());
+
+            std::array<std::size_t, N>       bucket_of { };
+            std::array<std::size_t, buckets> bucket_size { };
+
+            for(std::size_t i = 0; i < N; ++i) {
+                bucket_of[i] = enum_name_hash(names[i], 0) & (buckets - 1);
+                bucket_size[bucket_of[i]]++;
+            }
+
+            for(std::size_t size = N; size > 0; --size) {
+                for(std::size_t bucket = 0; bucket < buckets; ++bucket) {
+
+                    if(bucket_size[bucket] != size)
+                        continue;
+
+                    for(uint32_t seed = 1;; ++seed) {
+
+                        std::array<std::size_t, N> chosen { };
+                        std::size_t                placed = 0;
+
+                        for(std::size_t i = 0; i < N; ++i) {
+
+                            if(bucket_of[i] != bucket)
+                                continue;
+
+                            std::size_t slot = enum_name_hash(names[i], seed) & (slots - 1);
+
+                            bool collides = (table[slot] != 0);
+                            for(std::size_t j = 0; j < placed; ++j)
+                                collides = collides or ((chosen[j] & (slots - 1)) == slot);
+
+                            if(collides)
+                                break;
+
+                            // Remember both the slot and the name
+                            chosen[placed++] = slot | (i * slots);
+                        }
+
+                        if(placed != size)
+                            continue;
+
+                        for(std::size_t j = 0; j < placed; ++j)
+                            table[chosen[j] & (slots - 1)] = static_cast<uint16_t>(chosen[j] / slots + 1);
+
+                        seeds[bucket] = seed;
+
+                        break;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @returns
+         *    index of the name that @p name may be equal to or @p N if @p name is surely not in the set
+         */
+        constexpr std::size_t find(std::string_view name) const noexcept {
+
+            std::size_t bucket = enum_name_hash(name, 0) & (buckets - 1);
+            std::size_t slot   = enum_name_hash(name, seeds[bucket]) & (slots - 1);
+
+            return (table[slot] == 0) ? N : (table[slot] - 1);
+        }
+
+    };
+
+    template<typename Enum>
+    struct enum_reflection {
+
+        /// Range of scanned values
+        static constexpr long long   range_min  = enum_range<Enum>::min;
+        static constexpr long long   range_max  = enum_range<Enum>::max;
+        static constexpr std::size_t range_size = static_cast<std::size_t>(range_max - range_min + 1);
+
+        static_assert(range_min <= range_max, "[estd::enum_range] Invalid range");
+
+        /// Names of all values of the range
+        static constexpr auto range_names = enum_range_names<Enum>(std::make_index_sequence<range_size>{ });
+
+        /// Number of enumerators
+        static constexpr std::size_t count = [] {
+
+            std::size_t result = 0;
+            for(auto name : range_names)
+                result += not name.empty();
+
+            return result;
+
+        }();
+
+        /// Enumerators (sorted by underlying values)
+        static constexpr std::array<Enum, count> values = [] {
+
+            std::array<Enum, count> result { };
+            std::size_t             i = 0;
+
+            for(std::size_t v = 0; v < range_size; ++v) {
+                if(not range_names[v].empty())
+                    result[i++] = static_cast<Enum>(static_cast<std::underlying_type_t<Enum>>(range_min + static_cast<long long>(v)));
+            }
+
+            return result;
+
+        }();
+
+        /// Storage of null-terminated names of enumerators
+        static constexpr auto chars = [] {
+
+            constexpr std::size_t size = [] {
+
+                std::size_t result = 0;
+                for(auto name : range_names)
+                    result += name.empty() ? 0 : (name.size() + 1);
+
+                return result;
+
+            }();
+
+            std::array<char, size> result { };
+            std::size_t            i = 0;
+
+            for(auto name : range_names) {
+
+                if(name.empty())
+                    continue;
+
+                for(char c : name)
+                    result[i++] = c;
+
+                result[i++] = '\0';
+            }
+
+            return result;
+
+        }();
+
+        /// Names of enumerators (ordered as @ref values)
+        static constexpr std::array<std::string_view, count> names = [] {
+
+            std::array<std::string_view, count> result { };
+            std::size_t                         offset = 0;
+
+            for(std::size_t i = 0; i < count; ++i) {
+
+                std::size_t size = 0;
+                while(chars[offset + size] != '\0')
+                    ++size;
+
+                result[i]  = std::string_view{ chars.data() + offset, size };
+                offset    += size + 1;
+            }
+
+            return result;
+
+        }();
+
+        /// Lowest and highest values of enumerators
+        static constexpr long long lowest  = (count == 0) ? 0 : static_cast<long long>(estd::to_underlying(values[0]));
+        static constexpr long long highest = (count == 0) ? 0 : static_cast<long long>(estd::to_underlying(values[count - 1]));
+
+        /// Indicates whether enumerators have subsequent values
+        static constexpr bool contiguous = (count != 0) and (static_cast<std::size_t>(highest - lowest) + 1 == count);
+
+        /**
+         * @brief Indices of enumerators in @ref names for all values in [lowest, highest] (@ref count for
+         *    values not naming enumerators). Not needed for contiguous enumerations
+         */
+        static constexpr auto indices = [] {
+
+            using index_type = std::conditional_t<(count < std::numeric_limits<uint8_t>::max()), uint8_t, uint16_t>;
+
+            constexpr std::size_t size = (count == 0 or contiguous) ? 0 : static_cast<std::size_t>(highest - lowest + 1);
+
+            std::array<index_type, size> result { };
+
+            if constexpr (size != 0) {
+
+                for(auto &index : result)
+                    index = static_cast<index_type>(count);
+                for(std::size_t i = 0; i < count; ++i)
+                    result[static_cast<std::size_t>(estd::to_underlying(values[i]) - lowest)] = static_cast<index_type>(i);
+            }
+
+            return result;
+
+        }();
+
+        /// Perfect hash of names
+        static constexpr enum_names_perfect_hash<count> hash { names };
+
+    };
+
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+constexpr std::string_view to_string(Enum value) noexcept {
+
+    using reflection = details::enum_reflection<Enum>;
+
+    if constexpr (reflection::count == 0) {
+
+        return { };
+
+    } else {
+
+        auto v = static_cast<long long>(estd::to_underlying(value));
+
+        if(v < reflection::lowest or v > reflection::highest)
+            return { };
+
+        auto offset = static_cast<std::size_t>(v - reflection::lowest);
+
+        // Enumerators with subsequent values are indexed directly
+        if constexpr (reflection::contiguous) {
+            return reflection::names[offset];
+        } else {
+            std::size_t index = reflection::indices[offset];
+            return (index == reflection::count) ? std::string_view{ } : reflection::names[index];
+        }
+    }
+}
+
+
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+constexpr std::optional<Enum> from_string(std::string_view name) noexcept {
+
+    using reflection = details::enum_reflection<Enum>;
+
+    std::size_t index = reflection::hash.find(name);
+
+    if(index == reflection::count or reflection::names[index] != name)
+        return std::nullopt;
+
+    return reflection::values[index];
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
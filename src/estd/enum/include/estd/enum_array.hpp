@@ -0,0 +1,169 @@
+/* ============================================================================================================================ *//**
+ * @file       enum_array.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 5:20:37 am
+ * @modified   Monday, 19th October 2026 5:20:37 am
+ * @project    cpp-utils
+ * @brief      Definition of the enum_array class template - flat array indexed with enum class values
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_ENUM_ARRAY_H__
+#define __ESTD_ENUM_ARRAY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <cstddef>
+#include <type_traits>
+// Private includes
+#include "estd/enum.hpp"
+#include "estd/enum_reflection.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================== Enum array ========================================================== */
+
+/**
+ * @brief Fixed-size array holding a single @p T for each value of the @p Enum in the range [ @p Min, @p Max ].
+ *    Accessing the element is a single array access and iteration visits elements in the order of
+ *    underlying values of keys
+ * @note For sparse enumerations the array holds elements for values between enumerators as well
+ *
+ * @tparam Enum
+ *    type of the key
+ * @tparam T
+ *    type of the element
+ * @tparam Min
+ *    lowest key (by default obtained with enum reflection)
+ * @tparam Max
+ *    highest key (by default obtained with enum reflection)
+ */
+template<typename Enum, typename T, Enum Min = enum_min<Enum>, Enum Max = enum_max<Enum>>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+class enum_array {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    using key_type        = Enum;
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+public: /* --------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Lowest key
+    static constexpr Enum min_key = Min;
+
+    /// Highest key
+    static constexpr Enum max_key = Max;
+
+    /// Number of elements
+    static constexpr size_type extent = static_cast<size_type>(estd::to_underlying(Max) - estd::to_underlying(Min)) + 1;
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Constructs the array with value-initialized elements
+    constexpr enum_array() = default;
+
+    /// Constructs the array with all elements initialized to @p value
+    constexpr explicit enum_array(const T &value);
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    /// Accesses element indexed by @p key (no bounds checking)
+    constexpr T &operator[](Enum key) noexcept { return storage[index(key)]; }
+
+    /// Accesses element indexed by @p key (no bounds checking)
+    constexpr const T &operator[](Enum key) const noexcept { return storage[index(key)]; }
+
+    /// Compares arrays element-wise
+    constexpr bool operator==(const enum_array &other) const = default;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    @c true if @p key lies in the range of the array
+     */
+    static constexpr bool contains(Enum key) noexcept { return estd::is_valid_enum(key, Min, Max); }
+
+    /**
+     * @returns
+     *    index of the element indexed by @p key
+     */
+    static constexpr size_type index(Enum key) noexcept {
+        return static_cast<size_type>(estd::to_underlying(key) - estd::to_underlying(Min));
+    }
+
+    /**
+     * @returns
+     *    key of the @p i element
+     */
+    static constexpr Enum key(size_type i) noexcept {
+        return static_cast<Enum>(static_cast<std::underlying_type_t<Enum>>(estd::to_underlying(Min) + i));
+    }
+
+    /// Returns pointer to the element indexed by @p key or @c nullptr if the key is out of range
+    constexpr T *find(Enum key) noexcept { return contains(key) ? &storage[index(key)] : nullptr; }
+
+    /// Returns pointer to the element indexed by @p key or @c nullptr if the key is out of range
+    constexpr const T *find(Enum key) const noexcept { return contains(key) ? &storage[index(key)] : nullptr; }
+
+    /**
+     * @brief Sets all elements to @p value
+     */
+    constexpr void fill(const T &value);
+
+    /**
+     * @brief Calls @p f with each key and reference to the element in the order of keys
+     */
+    template<typename F>
+    constexpr void for_each(F &&f);
+
+    /**
+     * @brief Calls @p f with each key and reference to the element in the order of keys
+     */
+    template<typename F>
+    constexpr void for_each(F &&f) const;
+
+    /// Returns number of elements
+    static constexpr size_type size() noexcept { return extent; }
+
+    /// Returns pointer to the storage
+    constexpr T *data() noexcept { return storage.data(); }
+    constexpr const T *data() const noexcept { return storage.data(); }
+
+    /// Iterators over elements (in the order of keys)
+    constexpr iterator begin() noexcept { return storage.data(); }
+    constexpr iterator end() noexcept { return storage.data() + extent; }
+    constexpr const_iterator begin() const noexcept { return storage.data(); }
+    constexpr const_iterator end() const noexcept { return storage.data() + extent; }
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Elements
+    std::array<T, extent> storage { };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/enum/impl/enum_array.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
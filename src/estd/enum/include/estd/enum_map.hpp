@@ -0,0 +1,254 @@
+/* ============================================================================================================================ *//**
+ * @file       enum_map.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 5:20:37 am
+ * @modified   Monday, 19th October 2026 5:20:37 am
+ * @project    cpp-utils
+ * @brief      Definition of the enum_map class template - dense associative container keyed with enum class values
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_ENUM_MAP_H__
+#define __ESTD_ENUM_MAP_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+// Private includes
+#include "estd/enum.hpp"
+#include "estd/enum_reflection.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* =========================================================== Iterator =========================================================== */
+
+namespace details {
+
+    /**
+     * @brief Forward iterator over present elements of the enum_map yielding std::pair<Enum, Value&>
+     */
+    template<typename Map, typename Value>
+    class enum_map_iterator;
+
+}
+
+/* =========================================================== Enum map =========================================================== */
+
+/**
+ * @brief Associative container mapping values of the @p Enum in the range [ @p Min, @p Max ] to @p T.
+ *    Elements are stored in place in a flat array (constructed only when inserted) next to the presence
+ *    bitset, so that lookup is a single array access and iteration visits elements in the order of
+ *    underlying values of keys
+ * @note Keys passed to the map are required to lie in the range of the map (see contains_key())
+ *
+ * @tparam Enum
+ *    type of the key
+ * @tparam T
+ *    type of the element
+ * @tparam Min
+ *    lowest key (by default obtained with enum reflection)
+ * @tparam Max
+ *    highest key (by default obtained with enum reflection)
+ */
+template<typename Enum, typename T, Enum Min = enum_min<Enum>, Enum Max = enum_max<Enum>>
+    requires (std::is_enum_v<Enum> and estd::to_underlying(Min) <= estd::to_underlying(Max))
+class enum_map {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    using key_type       = Enum;
+    using mapped_type    = T;
+    using size_type      = std::size_t;
+    using iterator       = details::enum_map_iterator<enum_map, T>;
+    using const_iterator = details::enum_map_iterator<const enum_map, const T>;
+
+public: /* --------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Lowest key
+    static constexpr Enum min_key = Min;
+
+    /// Highest key
+    static constexpr Enum max_key = Max;
+
+    /// Maximal number of elements
+    static constexpr size_type extent = static_cast<size_type>(estd::to_underlying(Max) - estd::to_underlying(Min)) + 1;
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Constructs empty map
+    enum_map() noexcept = default;
+
+    /// Copy-constructs the map
+    enum_map(const enum_map &other);
+
+    /// Move-constructs the map (elements of @p other are moved from, but remain present)
+    enum_map(enum_map &&other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /// Copy-assigns the map
+    enum_map &operator=(const enum_map &other);
+
+    /// Move-assigns the map
+    enum_map &operator=(enum_map &&other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /// Destroys present elements
+    ~enum_map();
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    /**
+     * @returns
+     *    reference to the element indexed by @p key (default-constructed if not present)
+     */
+    T &operator[](Enum key);
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    @c true if @p key lies in the range of the map
+     */
+    static constexpr bool contains_key(Enum key) noexcept { return estd::is_valid_enum(key, Min, Max); }
+
+    /**
+     * @returns
+     *    @c true if the element indexed by @p key is present
+     */
+    bool contains(Enum key) const noexcept { return contains_key(key) and present.test(index(key)); }
+
+    /**
+     * @returns
+     *    pointer to the element indexed by @p key or @c nullptr if the element is not present
+     */
+    T *find(Enum key) noexcept { return contains(key) ? &element(index(key)) : nullptr; }
+
+    /**
+     * @returns
+     *    pointer to the element indexed by @p key or @c nullptr if the element is not present
+     */
+    const T *find(Enum key) const noexcept { return contains(key) ? &element(index(key)) : nullptr; }
+
+    /**
+     * @brief Constructs element indexed by @p key from @p args if it is not present
+     * @returns
+     *    pair of iterator to the element and @c true if the element has been inserted
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Enum key, Args&&... args);
+
+    /**
+     * @brief Inserts @p value under @p key or assigns it to the present element
+     * @returns
+     *    pair of iterator to the element and @c true if the element has been inserted
+     */
+    template<typename U>
+    std::pair<iterator, bool> insert_or_assign(Enum key, U &&value);
+
+    /**
+     * @brief Destroys element indexed by @p key
+     * @returns
+     *    number of erased elements (0 or 1)
+     */
+    size_type erase(Enum key) noexcept;
+
+    /**
+     * @brief Destroys all elements
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Calls @p f with key and reference to each present element in the order of keys
+     */
+    template<typename F>
+    void for_each(F &&f);
+
+    /**
+     * @brief Calls @p f with key and reference to each present element in the order of keys
+     */
+    template<typename F>
+    void for_each(F &&f) const;
+
+    /// Returns number of present elements
+    size_type size() const noexcept { return elements; }
+
+    /// Returns @c true if no element is present
+    bool empty() const noexcept { return elements == 0; }
+
+    /// Returns maximal number of elements
+    static constexpr size_type max_size() noexcept { return extent; }
+
+    /// Iterators over present elements (in the order of keys)
+    iterator begin() noexcept { return iterator{ this, first() }; }
+    iterator end() noexcept { return iterator{ this, extent }; }
+    const_iterator begin() const noexcept { return const_iterator{ this, first() }; }
+    const_iterator end() const noexcept { return const_iterator{ this, extent }; }
+
+private: /* ---------------------------------------------------- Private types ----------------------------------------------------- */
+
+    template<typename Map, typename Value>
+    friend class details::enum_map_iterator;
+
+    /// Uninitialized storage of a single element
+    struct slot {
+        alignas(T) std::byte bytes[sizeof(T)];
+    };
+
+private: /* ---------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /// Returns index of the element indexed by @p key
+    static constexpr size_type index(Enum key) noexcept {
+        return static_cast<size_type>(estd::to_underlying(key) - estd::to_underlying(Min));
+    }
+
+    /// Returns key of the @p i element
+    static constexpr Enum key(size_type i) noexcept {
+        return static_cast<Enum>(static_cast<std::underlying_type_t<Enum>>(estd::to_underlying(Min) + i));
+    }
+
+    /// Returns reference to the @p i element (required to be present)
+    T &element(size_type i) noexcept { return *std::launder(reinterpret_cast<T*>(slots[i].bytes)); }
+
+    /// Returns reference to the @p i element (required to be present)
+    const T &element(size_type i) const noexcept { return *std::launder(reinterpret_cast<const T*>(slots[i].bytes)); }
+
+    /// Returns index of the first present element not lower than @p i (or @ref extent)
+    size_type next(size_type i) const noexcept;
+
+    /// Returns index of the first present element (or @ref extent)
+    size_type first() const noexcept { return next(0); }
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Storage of elements
+    std::array<slot, extent> slots;
+
+    /// Presence of elements
+    std::bitset<extent> present;
+
+    /// Number of present elements
+    size_type elements { 0 };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/enum/impl/enum_map.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,139 @@
+/* ============================================================================================================================ *//**
+ * @file       enum_reflection.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 4:41:09 am
+ * @modified   Monday, 19th October 2026 5:20:37 am
+ * @project    cpp-utils
+ * @brief      Compile-time reflection of enumerations (names and values of enumerators) based on the signature
+ *             of function templates specialized with enumerated constants
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_ENUM_REFLECTION_H__
+#define __ESTD_ENUM_REFLECTION_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+// Private includes
+#include "estd/enum.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================= Declarations ========================================================= */
+
+/**
+ * @brief Range of underlying values scanned for enumerators of the @p Enum. May be specialized for enumerations
+ *    whose enumerators lie outside of the default range
+ *
+ * @tparam Enum
+ *    Enum type
+ */
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+struct enum_range {
+
+    /// Minimal scanned value
+    static constexpr long long min = std::is_signed_v<std::underlying_type_t<Enum>> ? -128 : 0;
+
+    /// Maximal scanned value
+    static constexpr long long max = 127;
+
+};
+
+namespace details {
+
+    /**
+     * @brief Compile-time tables describing enumerators of the @p Enum
+     */
+    template<typename Enum>
+    struct enum_reflection;
+
+}
+
+/**
+ * @brief Number of enumerators of the @p Enum
+ * @note Enumerators are looked up in the range given by @ref enum_range and are counted by distinct values
+ *    (aliases are reported under a single name chosen by the compiler)
+ * @note Enumerations are required to have fixed underlying type (as all scoped enumerations do) or to
+ *    be able to represent all values of the @ref enum_range
+ */
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+inline constexpr std::size_t enum_count = details::enum_reflection<Enum>::count;
+
+/**
+ * @brief Array of enumerators of the @p Enum sorted by underlying values
+ */
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+inline constexpr const auto &enum_values = details::enum_reflection<Enum>::values;
+
+/**
+ * @brief Array of names of enumerators of the @p Enum ordered as @ref enum_values
+ */
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+inline constexpr const auto &enum_names = details::enum_reflection<Enum>::names;
+
+/**
+ * @brief Enumerator of the @p Enum with the lowest underlying value
+ */
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+inline constexpr Enum enum_min = details::enum_reflection<Enum>::values.front();
+
+/**
+ * @brief Enumerator of the @p Enum with the highest underlying value
+ */
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+inline constexpr Enum enum_max = details::enum_reflection<Enum>::values.back();
+
+/**
+ * @brief Converts @p value to the name of the enumerator
+ * @tparam Enum
+ *    Enum type
+ * @param value
+ *    value to be converted
+ * @returns
+ *    name of the enumerator or empty string if @p value is not an enumerator of @p Enum
+ */
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+inline constexpr std::string_view to_string(Enum value) noexcept;
+
+/**
+ * @brief Converts @p name of the enumerator to the enumerated value using the perfect hash
+ *    generated at compile time
+ * @tparam Enum
+ *    Enum type
+ * @param name
+ *    name to be converted
+ * @returns
+ *    enumerator named @p name or std::nullopt if there is no such enumerator
+ */
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+inline constexpr std::optional<Enum> from_string(std::string_view name) noexcept;
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/enum/impl/enum_reflection.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
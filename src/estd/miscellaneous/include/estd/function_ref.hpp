@@ -0,0 +1,173 @@
+/* ============================================================================================================================ *//**
+ * @file       function_ref.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 6:47:52 am
+ * @modified   Monday, 19th October 2026 6:47:52 am
+ * @project    cpp-utils
+ * @brief      Definition of the function_ref class template - non-owning, two-word reference to a callable
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_FUNCTION_REF_H__
+#define __ESTD_FUNCTION_REF_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+// Private includes
+#include "estd/function_ref/function_ref.hpp"
+#include "estd/tag.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @brief Function reference class based on template specialization
+ */
+template<typename Signature>
+class function_ref;
+
+/**
+ * @brief Non-owning reference to a callable object. The reference consists of two words (bound object or
+ *    function and pointer to the call thunk) and is trivially copyable, so it is cheap to pass by value
+ *    into hot-path hooks. Referenced objects are required to outlive the reference
+ *
+ * @tparam R
+ *    result type
+ * @tparam Args
+ *    types of arguments
+ * @tparam Noexcept
+ *    if @c true only callables that do not throw are accepted
+ */
+template<typename R, typename... Args, bool Noexcept>
+class function_ref<R(Args...) noexcept(Noexcept)> {
+
+public: /* ---------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Result type of the function
+    using result_type = R;
+
+public: /* ---------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Creates an empty reference
+    constexpr function_ref() noexcept = default;
+
+    /// Creates an empty reference
+    constexpr function_ref(std::nullptr_t) noexcept { }
+
+    /**
+     * @brief Creates reference to the @p function (null @p function creates an empty reference)
+     */
+    template<typename F>
+        requires (std::is_function_v<F> and details::function_ref::is_invocable_using<Noexcept, F*, R, Args...>)
+    function_ref(F *function) noexcept {
+        if(function != nullptr) {
+            entity = function;
+            thunk  = &details::function_ref::invoke_bound<F, Noexcept, R, Args...>;
+        }
+    }
+
+    /**
+     * @brief Creates reference to the callable @p object (cv-qualification of the object is respected when
+     *    calling it)
+     */
+    template<typename F>
+        requires (
+            not std::is_same_v<std::remove_cvref_t<F>, function_ref>              and
+            not std::is_function_v<std::remove_pointer_t<std::remove_cvref_t<F>>> and
+            not std::is_member_pointer_v<std::remove_cvref_t<F>>                  and
+            details::function_ref::is_invocable_using<Noexcept, std::remove_reference_t<F>&, R, Args...>
+        )
+    function_ref(F &&object) noexcept :
+        entity{ std::addressof(object) },
+        thunk{ &details::function_ref::invoke_bound<std::remove_reference_t<F>, Noexcept, R, Args...> }
+    { }
+
+    /**
+     * @brief Creates reference to the callable @p Function known at compile time (function, pointer to
+     *    static member or captureless lambda). Such a reference binds no object
+     */
+    template<auto Function>
+        requires details::function_ref::is_invocable_using<Noexcept, decltype(Function), R, Args...>
+    constexpr function_ref(miscellaneous::vtag<Function>) noexcept :
+        thunk{ &details::function_ref::invoke_constant<Function, Noexcept, R, Args...> }
+    { }
+
+    /**
+     * @brief Creates reference to the @p Function known at compile time bound to the @p object - e.g. member
+     *    function called on the @p object, or free function taking the @p object as the first argument
+     */
+    template<auto Function, typename T>
+        requires details::function_ref::is_invocable_using<Noexcept, decltype(Function), R, T&, Args...>
+    function_ref(miscellaneous::vtag<Function>, T &object) noexcept :
+        entity{ std::addressof(object) },
+        thunk{ &details::function_ref::invoke_constant_bound<Function, T, Noexcept, R, Args...> }
+    { }
+
+    /// Copies the reference
+    constexpr function_ref(const function_ref &other) noexcept = default;
+
+public: /* --------------------------------------------------- Public operators -------------------------------------------------- */
+
+    /// Copies the reference
+    constexpr function_ref &operator=(const function_ref &other) noexcept = default;
+
+    /// Empties the reference
+    constexpr function_ref &operator=(std::nullptr_t) noexcept {
+        entity = details::function_ref::bound_entity{ };
+        thunk  = nullptr;
+        return *this;
+    }
+
+    /// Calls the referenced function
+    R operator()(Args... args) const noexcept(Noexcept) {
+        assert(thunk != nullptr);
+        return thunk(entity, std::forward<Args>(args)...);
+    }
+
+    /// Tests if function has been referenced
+    constexpr explicit operator bool() const noexcept {
+        return thunk != nullptr;
+    }
+
+    /// Tests for emptiness
+    friend constexpr bool operator==(const function_ref &f, std::nullptr_t) noexcept {
+        return not f;
+    }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Referenced object or function
+    details::function_ref::bound_entity entity;
+
+    /// Thunk calling the referenced callable
+    details::function_ref::thunk_type<Noexcept, R, Args...> *thunk { nullptr };
+
+};
+
+/* ===================================================== Deduction guides ========================================================= */
+
+template<typename R, typename... Args>
+function_ref(R(*)(Args...)) -> function_ref<R(Args...)>;
+
+template<typename R, typename... Args>
+function_ref(R(*)(Args...) noexcept) -> function_ref<R(Args...) noexcept>;
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,119 @@
+/* ============================================================================================================================ *//**
+ * @file       function_ref.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 6:47:52 am
+ * @modified   Monday, 19th October 2026 6:47:52 am
+ * @project    cpp-utils
+ * @brief      Type-erasure helpers of the function_ref class template (details)
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_FUNCTION_REF_FUNCTION_REF_H__
+#define __ESTD_FUNCTION_REF_FUNCTION_REF_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <functional>
+#include <type_traits>
+#include <utility>
+// Private includes
+#include "estd/callback/callback.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd::details::function_ref {
+
+/* ============================================================ Traits ============================================================ */
+
+/**
+ * @brief Type used to pass argument of type @p T through the thunk. Small trivially copyable arguments are
+ *    passed by value (in registers), all other are passed by reference so that by-value parameters of the
+ *    signature are moved exactly once - from the call operator directly into the target
+ */
+template<typename T>
+using param_t = std::conditional_t<
+    std::is_trivially_copyable_v<T> and sizeof(T) <= 2 * sizeof(void*),
+    T,
+    T&&
+>;
+
+/**
+ * @brief Checks whether @p F is invocable with @p Args returning @p R (nothrow if @p Noexcept is @c true)
+ */
+template<bool Noexcept, typename F, typename R, typename... Args>
+inline constexpr bool is_invocable_using = Noexcept ?
+    std::is_nothrow_invocable_r_v<R, F, Args...> :
+    std::is_invocable_r_v<R, F, Args...>;
+
+/* ============================================================ Storage =========================================================== */
+
+/**
+ * @brief Word bound to the function_ref - either pointer to the referenced object or pointer to the referenced
+ *    function (pointers to functions cannot be portably stored in void*)
+ */
+union bound_entity {
+
+    /// Creates storage bound to nothing
+    constexpr bound_entity() noexcept : object{ nullptr } { }
+
+    /// Binds the storage to the @p object
+    template<typename T>
+    constexpr bound_entity(T *object) noexcept : object{ const_cast<void*>(static_cast<const volatile void*>(object)) } { }
+
+    /// Binds the storage to the @p function
+    template<typename F>
+        requires std::is_function_v<F>
+    bound_entity(F *function) noexcept : function{ reinterpret_cast<void(*)()>(function) } { }
+
+    /// Returns the bound object
+    template<typename T>
+    T *get() const noexcept {
+        if constexpr (std::is_function_v<T>)
+            return reinterpret_cast<T*>(function);
+        else
+            return static_cast<T*>(object);
+    }
+
+    /// Referenced object
+    void *object;
+
+    /// Referenced function
+    void (*function)();
+
+};
+
+/* ============================================================ Thunks ============================================================ */
+
+/// Type of the thunk calling the bound entity
+template<bool Noexcept, typename R, typename... Args>
+using thunk_type = R(bound_entity, param_t<Args>...) noexcept(Noexcept);
+
+/// Calls object (or function) of type @p T bound to the @p entity
+template<typename T, bool Noexcept, typename R, typename... Args>
+R invoke_bound(bound_entity entity, param_t<Args>... args) noexcept(Noexcept) {
+    return details::callback::invoke_r<R>(*entity.get<T>(), std::forward<Args>(args)...);
+}
+
+/// Calls @p Function known at compile time with no bound entity
+template<auto Function, bool Noexcept, typename R, typename... Args>
+R invoke_constant(bound_entity, param_t<Args>... args) noexcept(Noexcept) {
+    return details::callback::invoke_r<R>(Function, std::forward<Args>(args)...);
+}
+
+/// Calls @p Function known at compile time with the object of type @p T bound to the @p entity as the first argument
+template<auto Function, typename T, bool Noexcept, typename R, typename... Args>
+R invoke_constant_bound(bound_entity entity, param_t<Args>... args) noexcept(Noexcept) {
+    return details::callback::invoke_r<R>(Function, *entity.get<T>(), std::forward<Args>(args)...);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd::details::function_ref
+
+/* ================================================================================================================================ */
+
+#endif
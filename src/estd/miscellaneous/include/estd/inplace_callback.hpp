@@ -0,0 +1,330 @@
+/* ============================================================================================================================ *//**
+ * @file       inplace_callback.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 6:02:14 am
+ * @modified   Monday, 19th October 2026 8:34:50 pm
+ * @project    cpp-utils
+ * @brief      Definition of the inplace_callback class template - counterpart of the estd::callback with configurable
+ *             inline capacity and per-type selection of the supported function objects
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_INPLACE_CALLBACK_H__
+#define __ESTD_INPLACE_CALLBACK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+// Private includes
+#include "estd/inplace_callback/inplace_callback.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @brief Kinds of function objects supported by the inplace_callback (replaces the global
+ *    CONF_CALLBACK_NONTRIVIAL switch of the estd::callback with the per-type choice)
+ */
+enum class callback_ops {
+
+    /// Only trivially copyable function objects; callback holds a single call pointer and is trivially copyable
+    trivial,
+    /// Copy-constructible and nothrow-move-constructible function objects; callback holds pointer to the constant table of operations
+    copyable,
+    /// Nothrow-move-constructible function objects; callback holds pointer to the constant table of operations and is move-only
+    move_only,
+
+};
+
+/**
+ * @brief Default inline capacity of the inplace_callback (the same as capacity of the estd::callback -
+ *    pointer to member function and pointer to object)
+ */
+inline constexpr std::size_t inplace_callback_default_capacity = sizeof(details::callback::callback_base::Store);
+
+/**
+ * @brief Callback class based on template specialization
+ */
+template<typename Signature, std::size_t Capacity = inplace_callback_default_capacity, callback_ops Ops = callback_ops::copyable>
+class inplace_callback;
+
+/**
+ * @brief Type-erased callable wrapper storing the function object in place (the callback never allocates -
+ *    function objects that do not fit into @p Capacity bytes are rejected at compile time)
+ *
+ * @tparam R
+ *    result type
+ * @tparam Args
+ *    types of arguments
+ * @tparam Capacity
+ *    size of the inline storage
+ * @tparam Ops
+ *    kind of supported function objects
+ */
+template<typename R, typename... Args, std::size_t Capacity, callback_ops Ops>
+class inplace_callback<R(Args...), Capacity, Ops> {
+
+public: /* ---------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Result type of the callback
+    using result_type = R;
+
+public: /* -------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Size of the inline storage
+    static constexpr std::size_t capacity = Capacity;
+
+    /// Alignment of the inline storage
+    static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+    /// Kind of supported function objects
+    static constexpr callback_ops ops_kind = Ops;
+
+    /**
+     * @brief Checks whether the function object of type @p F can be stored in the callback (non-trivial function
+     *    objects are moved by the noexcept move operations of the callback, so they must not throw when moved)
+     */
+    template<typename F>
+    static constexpr bool can_store =
+        (sizeof(F) <= Capacity and alignof(F) <= alignment)                                 and
+        (Ops != callback_ops::trivial   or std::is_trivially_copyable_v<F>)                  and
+        (Ops != callback_ops::copyable  or std::is_copy_constructible_v<F>)                  and
+        (Ops == callback_ops::trivial   or std::is_nothrow_move_constructible_v<F>);
+
+public: /* ---------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Creates an empty callback
+    inplace_callback() noexcept = default;
+
+    /// Creates an empty callback
+    inplace_callback(std::nullptr_t) noexcept { }
+
+    /**
+     * @brief Creates the callback with a function object or a function pointer (null function pointer
+     *    creates an empty callback)
+     */
+    template<typename F>
+        requires (not std::is_same_v<std::remove_cvref_t<F>, inplace_callback> and std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    inplace_callback(F &&f) {
+
+        using target = std::decay_t<F>;
+
+        static_assert(sizeof(target) <= Capacity,
+            "[estd::inplace_callback] Function object does not fit into the inline storage - increase the Capacity");
+        static_assert(alignof(target) <= alignment,
+            "[estd::inplace_callback] Function object is over-aligned for the inline storage");
+        static_assert(Ops != callback_ops::trivial or std::is_trivially_copyable_v<target>,
+            "[estd::inplace_callback] Function object must be TriviallyCopyable - use callback_ops::copyable");
+        static_assert(Ops != callback_ops::copyable or std::is_copy_constructible_v<target>,
+            "[estd::inplace_callback] Function object must be CopyConstructible - use callback_ops::move_only");
+        static_assert(Ops == callback_ops::trivial or std::is_nothrow_move_constructible_v<target>,
+            "[estd::inplace_callback] Function object must be NothrowMoveConstructible");
+
+        if constexpr (std::is_pointer_v<target> or std::is_member_pointer_v<target>) {
+            if(f == nullptr)
+                return;
+        }
+
+        generate<target>(std::forward<F>(f));
+    }
+
+    /// Copies the callback
+    inplace_callback(const inplace_callback &other) requires (Ops == callback_ops::trivial) = default;
+
+    /// Copies the callback
+    inplace_callback(const inplace_callback &other) requires (Ops == callback_ops::copyable) {
+        if(other.control != nullptr) {
+            other.control->copy(storage, other.storage);
+            control = other.control;
+        }
+    }
+
+    /// Moves the callback
+    inplace_callback(inplace_callback &&other) noexcept requires (Ops == callback_ops::trivial) = default;
+
+    /// Moves the callback (@p other is left empty)
+    inplace_callback(inplace_callback &&other) noexcept requires (Ops != callback_ops::trivial) {
+        if(other.control != nullptr) {
+            other.control->move(storage, other.storage);
+            control       = other.control;
+            other.control = nullptr;
+        }
+    }
+
+    /// Destroys the callback
+    ~inplace_callback() requires (Ops == callback_ops::trivial) = default;
+
+    /// Destroys the callback
+    ~inplace_callback() requires (Ops != callback_ops::trivial) {
+        reset();
+    }
+
+public: /* --------------------------------------------------- Public operators -------------------------------------------------- */
+
+    /// Assigns the callback
+    inplace_callback &operator=(const inplace_callback &other) requires (Ops == callback_ops::trivial) = default;
+
+    /// Assigns the callback
+    inplace_callback &operator=(const inplace_callback &other) requires (Ops == callback_ops::copyable) {
+
+        if(this != &other) {
+
+            reset();
+
+            if(other.control != nullptr) {
+                other.control->copy(storage, other.storage);
+                control = other.control;
+            }
+        }
+
+        return *this;
+    }
+
+    /// Assigns the callback
+    inplace_callback &operator=(inplace_callback &&other) noexcept requires (Ops == callback_ops::trivial) = default;
+
+    /// Assigns the callback (@p other is left empty)
+    inplace_callback &operator=(inplace_callback &&other) noexcept requires (Ops != callback_ops::trivial) {
+
+        if(this != &other) {
+
+            reset();
+
+            if(other.control != nullptr) {
+                other.control->move(storage, other.storage);
+                control       = other.control;
+                other.control = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    /// Empties the callback
+    inplace_callback &operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    /// Calls the attached function
+    R operator()(Args... args) const {
+        return call(std::forward<Args>(args)...);
+    }
+
+    /// Tests if function has been assigned
+    explicit operator bool() const noexcept {
+        return control != nullptr;
+    }
+
+    /// Tests for emptiness
+    friend bool operator==(const inplace_callback &f, std::nullptr_t) noexcept {
+        return not f;
+    }
+
+public: /* --------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /// Calls the attached function
+    R call(Args... args) const {
+
+        assert(bool(*this));
+
+        // Need for const_cast here correlates to a std::function bug - see P0045 and N4159
+        void *target = const_cast<std::byte*>(storage);
+
+        if constexpr (Ops == callback_ops::trivial)
+            return control(target, std::forward<Args>(args)...);
+        else
+            return control->call(target, std::forward<Args>(args)...);
+    }
+
+    /// Empties the callback (destroys the stored function object)
+    void reset() noexcept {
+
+        if constexpr (Ops != callback_ops::trivial) {
+            if(control != nullptr)
+                control->destroy(storage);
+        }
+
+        control = nullptr;
+    }
+
+    /// Swaps callbacks
+    void swap(inplace_callback &other) noexcept {
+        if(this != &other) {
+            inplace_callback tmp{ std::move(other) };
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+    }
+
+    /**
+     * @brief Static thunk for passing as C-style function
+     *
+     * @param func
+     *    callback to call passed as void pointer
+     * @param args
+     *    arguments to be called with function func
+     */
+    static R thunk(void *func, Args... args) {
+        return static_cast<inplace_callback*>(func)->call(std::forward<Args>(args)...);
+    }
+
+private: /* --------------------------------------------------- Private types ---------------------------------------------------- */
+
+    /// Type of the control word
+    using control_type = std::conditional_t<Ops == callback_ops::trivial,
+        details::inplace_callback::call_type<R, Args...> *,
+        const details::inplace_callback::ops<R, Args...> *
+    >;
+
+private: /* -------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    /**
+     * @brief Constructs the function object of type @p F in the storage (storage is assumed to be empty)
+     */
+    template<typename F, typename G>
+    void generate(G &&f) {
+
+        new (storage) F(std::forward<G>(f));
+
+        if constexpr (Ops == callback_ops::trivial)
+            control = &details::inplace_callback::target_call<F, R, Args...>;
+        else
+            control = &details::inplace_callback::ops_for<F, Ops == callback_ops::copyable, R, Args...>;
+    }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Storage of the function object
+    alignas(alignment) std::byte storage[Capacity];
+
+    /// Call pointer (trivial callbacks) or pointer to the table of operations
+    control_type control { nullptr };
+
+};
+
+/* ====================================================== Auxiliary functions ===================================================== */
+
+/// Swaps callbacks
+template<typename Signature, std::size_t Capacity, callback_ops Ops>
+void swap(inplace_callback<Signature, Capacity, Ops> &lhs, inplace_callback<Signature, Capacity, Ops> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
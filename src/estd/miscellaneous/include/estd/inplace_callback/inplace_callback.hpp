@@ -0,0 +1,112 @@
+/* ============================================================================================================================ *//**
+ * @file       inplace_callback.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 6:02:14 am
+ * @modified   Monday, 19th October 2026 8:34:50 pm
+ * @project    cpp-utils
+ * @brief      Type-erasure operations of the inplace_callback class template (details)
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_INPLACE_CALLBACK_INPLACE_CALLBACK_H__
+#define __ESTD_INPLACE_CALLBACK_INPLACE_CALLBACK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <new>
+#include <type_traits>
+#include <utility>
+// Private includes
+#include "estd/callback/callback.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd::details::inplace_callback {
+
+/* ========================================================== Operations ========================================================== */
+
+/// Type-erased call of the target stored at @p storage
+template<typename R, typename... Args>
+using call_type = R(void *storage, Args&&... args);
+
+/**
+ * @brief Table of type-erased operations on the target (one constant table per target type)
+ */
+template<typename R, typename... Args>
+struct ops {
+
+    /// Calls the target
+    call_type<R, Args...> *call;
+
+    /// Move-constructs target at @p dst from the one at @p src and destroys the source
+    void (*move)(void *dst, void *src) noexcept;
+
+    /// Copy-constructs target at @p dst from the one at @p src (nullptr for move-only tables)
+    void (*copy)(void *dst, const void *src);
+
+    /// Destroys the target
+    void (*destroy)(void *storage) noexcept;
+
+};
+
+/// Calls target of type @p F stored at @p storage
+template<typename F, typename R, typename... Args>
+R target_call(void *storage, Args&&... args) {
+    return details::callback::invoke_r<R>(*std::launder(reinterpret_cast<F*>(storage)), std::forward<Args>(args)...);
+}
+
+/// Move-constructs target of type @p F at @p dst from @p src and destroys the source
+template<typename F>
+void target_move(void *dst, void *src) noexcept {
+    static_assert(std::is_nothrow_move_constructible_v<F>, "[estd::inplace_callback] Moved target must be NothrowMoveConstructible");
+    F *source = std::launder(reinterpret_cast<F*>(src));
+    new (dst) F(std::move(*source));
+    source->~F();
+}
+
+/// Copy-constructs target of type @p F at @p dst from @p src
+template<typename F>
+void target_copy(void *dst, const void *src) {
+    new (dst) F(*std::launder(reinterpret_cast<const F*>(src)));
+}
+
+/// Destroys target of type @p F at @p storage
+template<typename F>
+void target_destroy(void *storage) noexcept {
+    std::launder(reinterpret_cast<F*>(storage))->~F();
+}
+
+/// Returns copy operation of the target of type @p F (nullptr if @p Copyable is @c false)
+template<typename F, bool Copyable>
+constexpr auto target_copy_op() noexcept -> void (*)(void *, const void *) {
+    if constexpr (Copyable)
+        return &target_copy<F>;
+    else
+        return nullptr;
+}
+
+/**
+ * @brief Constant table of operations on the target of type @p F
+ *
+ * @tparam Copyable
+ *    if @c true the table contains the copy operation
+ */
+template<typename F, bool Copyable, typename R, typename... Args>
+inline constexpr ops<R, Args...> ops_for {
+    &target_call<F, R, Args...>,
+    &target_move<F>,
+    target_copy_op<F, Copyable>(),
+    &target_destroy<F>
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd::details::inplace_callback
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,258 @@
+/* ============================================================================================================================ *//**
+ * @file       signal.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 7:34:18 am
+ * @modified   Monday, 19th October 2026 10:07:52 pm
+ * @project    cpp-utils
+ * @brief      Definition of the signal class template - dispatcher of events to the set of callbacks with lock-free
+ *             emission
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SIGNAL_H__
+#define __ESTD_SIGNAL_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+// Private includes
+#include "estd/callback.hpp"
+#include "estd/rcu_ptr.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================== Connection ========================================================== */
+
+/**
+ * @brief RAII handle of the connection between the signal and the slot. Handle disconnects the slot when
+ *    destroyed (unless released)
+ * @note Handle is required not to outlive the signal it has been returned from
+ */
+class signal_connection {
+
+public: /* ---------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Creates empty handle
+    signal_connection() noexcept = default;
+
+    /// No copy-constructible
+    signal_connection(const signal_connection &other) = delete;
+    /// No copy-asignable
+    signal_connection &operator=(const signal_connection &other) = delete;
+
+    /// Moves the handle
+    inline signal_connection(signal_connection &&other) noexcept;
+
+    /// Moves the handle (connection held by this handle is disconnected)
+    inline signal_connection &operator=(signal_connection &&other);
+
+    /**
+     * @brief Disconnects the slot
+     * @note Disconnecting allocates the new snapshot of slots - allocation failure in the destructor terminates
+     *    the program, so disconnect() should be called explicitly where it has to be handled
+     */
+    inline ~signal_connection();
+
+public: /* --------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Disconnects the slot (no-op if the handle is empty)
+     * @throws std::bad_alloc
+     *    if the new snapshot of slots cannot be allocated (the slot stays connected)
+     */
+    inline void disconnect();
+
+    /**
+     * @brief Releases the connection so that it remains active after the handle is destroyed
+     */
+    inline void release() noexcept;
+
+    /// Returns @c true if the handle holds the connection
+    bool connected() const noexcept { return owner != nullptr; }
+
+private: /* ---------------------------------------------------- Private types ---------------------------------------------------- */
+
+    template<typename Signature>
+    friend class signal;
+
+    /// Type of the function disconnecting the slot from the signal
+    using disconnector = void(void *owner, std::uint64_t id);
+
+private: /* ---------------------------------------------------- Private ctors ---------------------------------------------------- */
+
+    /// Creates the handle
+    signal_connection(void *owner, disconnector *disconnect, std::uint64_t id) noexcept :
+        owner{ owner }, disconnect_slot{ disconnect }, id{ id }
+    { }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Signal the slot is connected to
+    void *owner { nullptr };
+
+    /// Function disconnecting the slot
+    disconnector *disconnect_slot { nullptr };
+
+    /// Identifier of the slot
+    std::uint64_t id { 0 };
+
+};
+
+/* ============================================================ Signal ============================================================ */
+
+/**
+ * @brief Signal class based on template specialization
+ */
+template<typename Signature>
+class signal;
+
+/**
+ * @brief Dispatcher calling the set of connected callbacks (slots) whenever the signal is emitted.
+ *
+ * @details Slots are kept in an immutable snapshot published with an atomic pointer. Emission does not
+ *    take any lock and writes no shared cache line: it marks the read section in the calling thread's
+ *    epoch record (the one used by the estd::rcu_ptr), loads the snapshot and calls slots in the order
+ *    of connection. Connecting and disconnecting are expected to be rare: they are serialized with
+ *    a mutex, copy the snapshot and publish the copy. Replaced snapshots are reclaimed once every
+ *    emission that could have observed them has finished (i.e. no thread remains in the read section
+ *    entered before the snapshot was replaced) - writers never wait for readers, so slots may freely
+ *    connect and disconnect (including themselves) while being called.
+ *
+ * @note Slot disconnected during an emission may still be called by emissions already in progress
+ *
+ * @tparam Args
+ *    types of arguments of slots
+ */
+template<typename... Args>
+class signal<void(Args...)> {
+
+public: /* ---------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the slot
+    using slot_type = ::estd::callback<void(Args...)>;
+
+    /// Type of the connection handle
+    using connection = signal_connection;
+
+public: /* ---------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Creates signal with no slots
+    inline signal();
+
+    /// No copy-constructible
+    signal(const signal &other) = delete;
+    /// No copy-asignable
+    signal &operator=(const signal &other) = delete;
+
+    /**
+     * @brief Destroys the signal
+     * @note No emission may be in progress and no connection handle may be held when the signal is destroyed
+     */
+    inline ~signal();
+
+public: /* --------------------------------------------------- Public operators -------------------------------------------------- */
+
+    /// Emits the signal
+    void operator()(const Args&... args) const { emit(args...); }
+
+public: /* --------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Calls all connected slots with @p args in the order of connection
+     */
+    inline void emit(const Args&... args) const;
+
+    /**
+     * @brief Connects the slot constructed from @p args (forwarded to the estd::callback's constructor)
+     * @returns
+     *    RAII handle of the connection
+     */
+    template<typename... SlotArgs>
+    [[nodiscard]] inline connection connect(SlotArgs&&... args);
+
+    /**
+     * @brief Disconnects all slots (disconnecting through connection handles afterwards is a no-op)
+     */
+    inline void disconnect_all();
+
+    /// Returns number of connected slots
+    std::size_t size() const noexcept { return slots.load(std::memory_order_relaxed); }
+
+    /// Returns @c true if no slot is connected
+    bool empty() const noexcept { return size() == 0; }
+
+private: /* ---------------------------------------------------- Private types ---------------------------------------------------- */
+
+    /// Connected slot
+    struct entry {
+        std::uint64_t id;
+        slot_type slot;
+    };
+
+    /// Immutable snapshot of connected slots
+    struct snapshot {
+        std::vector<entry> entries;
+    };
+
+    /// Snapshot replaced by the writer awaiting reclamation
+    struct retired_snapshot {
+        const snapshot *list;
+        std::uint64_t epoch;
+    };
+
+private: /* --------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /// Disconnects slot with the given @p id from the signal pointed by @p owner
+    static inline void disconnect(void *owner, std::uint64_t id);
+
+    /**
+     * @brief Publishes @p list as the current snapshot and retires the replaced one (requires writer's lock)
+     */
+    inline void publish(const snapshot *list);
+
+    /**
+     * @brief Deletes retired snapshots that no emission in progress may observe (requires writer's lock)
+     */
+    inline void reclaim() noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Current snapshot of slots (@c nullptr if no slot is connected)
+    std::atomic<const snapshot *> current { nullptr };
+
+    /// Number of connected slots
+    std::atomic<std::size_t> slots { 0 };
+
+    /// Lock serializing writers
+    std::mutex writer_lock;
+
+    /// Snapshots awaiting reclamation
+    std::vector<retired_snapshot> retired;
+
+    /// Identifier of the next connected slot
+    std::uint64_t next_id { 1 };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/signal/impl/signal.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
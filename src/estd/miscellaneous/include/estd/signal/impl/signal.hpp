@@ -0,0 +1,221 @@
+/* ============================================================================================================================ *//**
+ * @file       signal.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 7:34:18 am
+ * @modified   Monday, 19th October 2026 10:07:52 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the signal class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SIGNAL_IMPL_SIGNAL_H__
+#define __ESTD_SIGNAL_IMPL_SIGNAL_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <algorithm>
+#include <memory>
+#include "estd/signal.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ======================================================== Auxiliary types ======================================================= */
+
+namespace details::signal {
+
+    /**
+     * @brief RAII read section of the emission (marks the calling thread's epoch record)
+     */
+    class read_section {
+    public:
+
+        read_section() noexcept { details::rcu::pin(); }
+        ~read_section() { details::rcu::unpin(); }
+
+    };
+
+}
+
+/* ======================================================= signal_connection ====================================================== */
+
+signal_connection::signal_connection(signal_connection &&other) noexcept :
+    owner{ std::exchange(other.owner, nullptr) },
+    disconnect_slot{ other.disconnect_slot },
+    id{ other.id }
+{ }
+
+
+signal_connection &signal_connection::operator=(signal_connection &&other) {
+
+    if(this != &other) {
+        disconnect();
+        owner           = std::exchange(other.owner, nullptr);
+        disconnect_slot = other.disconnect_slot;
+        id              = other.id;
+    }
+
+    return *this;
+}
+
+
+signal_connection::~signal_connection() {
+    disconnect();
+}
+
+
+void signal_connection::disconnect() {
+    if(owner != nullptr) {
+        disconnect_slot(owner, id);
+        owner = nullptr;
+    }
+}
+
+
+void signal_connection::release() noexcept {
+    owner = nullptr;
+}
+
+/* ============================================================ signal ============================================================ */
+
+template<typename... Args>
+signal<void(Args...)>::signal() = default;
+
+
+template<typename... Args>
+signal<void(Args...)>::~signal() {
+
+    delete current.load(std::memory_order_relaxed);
+
+    for(auto &snapshot : retired)
+        delete snapshot.list;
+}
+
+
+template<typename... Args>
+void signal<void(Args...)>::emit(const Args&... args) const {
+
+    details::signal::read_section section;
+
+    // Pairs with the scan of epoch records in reclaim() - either the reader is seen or it sees the new snapshot
+    const snapshot *list = current.load(std::memory_order_seq_cst);
+
+    if(list == nullptr)
+        return;
+
+    for(auto &entry : list->entries)
+        entry.slot(args...);
+}
+
+
+template<typename... Args>
+template<typename... SlotArgs>
+signal_connection signal<void(Args...)>::connect(SlotArgs&&... args) {
+
+    std::lock_guard lock{ writer_lock };
+
+    auto list = std::make_unique<snapshot>();
+
+    if(auto *previous = current.load(std::memory_order_relaxed); previous != nullptr) {
+        list->entries.reserve(previous->entries.size() + 1);
+        list->entries.insert(list->entries.end(), previous->entries.begin(), previous->entries.end());
+    }
+
+    std::uint64_t id = next_id;
+    list->entries.push_back(entry{ id, slot_type(std::forward<SlotArgs>(args)...) });
+    ++next_id;
+
+    publish(list.release());
+
+    return signal_connection{ this, &signal::disconnect, id };
+}
+
+
+template<typename... Args>
+void signal<void(Args...)>::disconnect_all() {
+
+    std::lock_guard lock{ writer_lock };
+
+    publish(nullptr);
+}
+
+
+template<typename... Args>
+void signal<void(Args...)>::disconnect(void *owner, std::uint64_t id) {
+
+    auto &self = *static_cast<signal*>(owner);
+
+    std::lock_guard lock{ self.writer_lock };
+
+    auto *previous = self.current.load(std::memory_order_relaxed);
+    if(previous == nullptr)
+        return;
+
+    auto it = std::find_if(previous->entries.begin(), previous->entries.end(),
+        [id](const entry &e) { return e.id == id; });
+    if(it == previous->entries.end())
+        return;
+
+    // Last slot is disconnected
+    if(previous->entries.size() == 1) {
+        self.publish(nullptr);
+        return;
+    }
+
+    auto list = std::make_unique<snapshot>();
+    list->entries.reserve(previous->entries.size() - 1);
+    list->entries.insert(list->entries.end(), previous->entries.begin(), it);
+    list->entries.insert(list->entries.end(), std::next(it), previous->entries.end());
+
+    self.publish(list.release());
+}
+
+
+template<typename... Args>
+void signal<void(Args...)>::publish(const snapshot *list) {
+
+    // Make room for the replaced snapshot first, so that nothing throws once the new one is published
+    retired.reserve(retired.size() + 1);
+
+    auto *previous = current.exchange(list, std::memory_order_seq_cst);
+
+    slots.store(list != nullptr ? list->entries.size() : 0, std::memory_order_relaxed);
+
+    /**
+     * Emissions that enter their sections in the new epoch are guaranteed to observe the new snapshot,
+     * so the previous one can be deleted once no emission remains in the older epochs
+     */
+    if(previous != nullptr)
+        retired.push_back(retired_snapshot{ previous, details::rcu::default_domain().advance() });
+
+    reclaim();
+}
+
+
+template<typename... Args>
+void signal<void(Args...)>::reclaim() noexcept {
+
+    if(retired.empty())
+        return;
+
+    std::uint64_t oldest = details::rcu::default_domain().oldest_reader();
+
+    std::erase_if(retired, [oldest](const retired_snapshot &snapshot) {
+        if(snapshot.epoch > oldest)
+            return false;
+        delete snapshot.list;
+        return true;
+    });
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
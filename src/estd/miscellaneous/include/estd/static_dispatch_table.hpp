@@ -0,0 +1,200 @@
+/* ============================================================================================================================ *//**
+ * @file       static_dispatch_table.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 8:12:40 am
+ * @modified   Monday, 19th October 2026 10:21:46 pm
+ * @project    cpp-utils
+ * @brief      Definition of the static_dispatch_table class template - set of handlers known at compile time
+ *             dispatched by index without indirect calls
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_STATIC_DISPATCH_TABLE_H__
+#define __ESTD_STATIC_DISPATCH_TABLE_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+// Private includes
+#include "estd/static_dispatch_table/static_dispatch_table.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @brief Table of handlers known at compile time dispatched by index (or enumerator). Handlers are given
+ *    as NTTPs (functions, pointers to member functions, captureless lambdas, constant function objects),
+ *    so dispatch expands to switch statements (16 cases each) with direct calls that the compiler lowers
+ *    to jump tables with handlers inlined into the branches - no pointer to the handler is ever loaded
+ *    at runtime.
+ *
+ *    @code
+ *
+ *    using packet_handlers = estd::static_dispatch_table<
+ *        &handle_ping,
+ *        &handle_data,
+ *        &session::handle_close
+ *    >;
+ *
+ *    // Type of the packet comes from the wire, so it has to be range-checked
+ *    if(not packet_handlers::try_dispatch(header.type, session, payload))
+ *        session.reject(header);
+ *
+ *    @endcode
+ *
+ * @note Handlers are invoked with std::invoke semantics, so the object the pointer to member function is
+ *    called on is passed as the first argument
+ *
+ * @tparam Handlers
+ *    handlers of the table (index of the handler is its position in the list)
+ */
+template<auto... Handlers>
+    requires (sizeof...(Handlers) > 0)
+class static_dispatch_table {
+
+public: /* ---------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /**
+     * @brief Type returned by the dispatch with arguments of types @p Args (common type of results
+     *    of all handlers)
+     */
+    template<typename... Args>
+    using result_t = std::common_type_t<std::invoke_result_t<decltype(Handlers), Args...>...>;
+
+public: /* -------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Number of handlers
+    static constexpr std::size_t size = sizeof...(Handlers);
+
+    /**
+     * @brief Checks whether all handlers are invocable with arguments of types @p Args
+     */
+    template<typename... Args>
+    static constexpr bool invocable_with = (std::is_invocable_v<decltype(Handlers), Args...> and ...);
+
+public: /* --------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    @c true if the table contains handler with the given @p index
+     */
+    static constexpr bool contains(std::size_t index) noexcept { return index < size; }
+
+    /**
+     * @returns
+     *    @c true if the table contains handler with index equal to the underlying value of the @p key
+     *    (negative values are never contained)
+     */
+    template<typename Enum>
+        requires std::is_enum_v<Enum>
+    static constexpr bool contains(Enum key) noexcept { return contains(index_of(key)); }
+
+    /**
+     * @brief Calls handler with the given @p index with @p args
+     * @note @p index is required to be lower than @ref size (out-of-range indices are asserted in debug
+     *    builds and dispatched to the last handler otherwise, so that the compiler may use it as the
+     *    default branch of the jump table)
+     *
+     * @param index
+     *    index of the handler
+     * @param args
+     *    arguments of the handler
+     * @returns
+     *    result of the handler converted to @ref result_t
+     */
+    template<typename... Args>
+        requires invocable_with<Args&&...>
+    static constexpr result_t<Args&&...> dispatch(std::size_t index, Args&&... args) {
+        assert(contains(index));
+        return details::static_dispatch<result_t<Args&&...>, 0, Handlers...>(index, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Calls handler with index equal to the underlying value of the @p key with @p args
+     * @note The same precondition as for the index applies - keys that do not come from a trusted
+     *    source should be dispatched with try_dispatch()
+     */
+    template<typename Enum, typename... Args>
+        requires (std::is_enum_v<Enum> and invocable_with<Args&&...>)
+    static constexpr result_t<Args&&...> dispatch(Enum key, Args&&... args) {
+        assert(contains(key));
+        return dispatch(index_of(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Calls handler with the given @p index with @p args if it is present
+     * @returns
+     *    @c true if the handler has been called
+     */
+    template<typename... Args>
+        requires invocable_with<Args&&...>
+    static constexpr bool try_dispatch(std::size_t index, Args&&... args) {
+
+        if(not contains(index))
+            return false;
+
+        details::static_dispatch<void, 0, Handlers...>(index, std::forward<Args>(args)...);
+
+        return true;
+    }
+
+    /**
+     * @brief Calls handler with index equal to the underlying value of the @p key with @p args if it
+     *    is present
+     * @returns
+     *    @c true if the handler has been called
+     */
+    template<typename Enum, typename... Args>
+        requires (std::is_enum_v<Enum> and invocable_with<Args&&...>)
+    static constexpr bool try_dispatch(Enum key, Args&&... args) {
+        return try_dispatch(index_of(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Calls handler with the index @p I known at compile time with @p args
+     */
+    template<std::size_t I, typename... Args>
+        requires (I < sizeof...(Handlers))
+    static constexpr decltype(auto) invoke(Args&&... args) {
+        return std::invoke(details::static_dispatch_handler<I, Handlers...>(), std::forward<Args>(args)...);
+    }
+
+private: /* ---------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /**
+     * @returns
+     *    index of the handler associated with the @p key (@ref size for negative underlying values)
+     */
+    template<typename Enum>
+    static constexpr std::size_t index_of(Enum key) noexcept {
+
+        auto value = static_cast<std::underlying_type_t<Enum>>(key);
+
+        if constexpr (std::is_signed_v<std::underlying_type_t<Enum>>) {
+            if(value < 0)
+                return size;
+        }
+
+        return static_cast<std::size_t>(value);
+    }
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
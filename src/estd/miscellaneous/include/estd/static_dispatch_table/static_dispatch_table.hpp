@@ -0,0 +1,99 @@
+/* ============================================================================================================================ *//**
+ * @file       static_dispatch_table.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 8:12:40 am
+ * @modified   Monday, 19th October 2026 8:12:40 am
+ * @project    cpp-utils
+ * @brief      Auxiliary functions of the static_dispatch_table class template (details)
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_STATIC_DISPATCH_TABLE_STATIC_DISPATCH_TABLE_H__
+#define __ESTD_STATIC_DISPATCH_TABLE_STATIC_DISPATCH_TABLE_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd::details {
+
+/* ======================================================= Auxiliary functions ==================================================== */
+
+/**
+ * @brief Selects handler with the index @p I out of [ @p Handler, @p Rest... ]
+ */
+template<std::size_t I, auto Handler, auto... Rest>
+constexpr auto static_dispatch_handler() noexcept {
+    if constexpr (I == 0)
+        return Handler;
+    else
+        return static_dispatch_handler<I - 1, Rest...>();
+}
+
+/// Number of cases of the single switch statement generated by the static_dispatch()
+inline constexpr std::size_t static_dispatch_cases = 16;
+
+/// Case of the switch statement generated by the static_dispatch()
+#define ESTD_STATIC_DISPATCH_CASE(n)                                                                                  \
+    case n:                                                                                                           \
+        if constexpr (Base + n < sizeof...(Handlers))                                                                 \
+            return static_cast<R>(std::invoke(                                                                        \
+                static_dispatch_handler<Base + n, Handlers...>(), std::forward<Args>(args)...));                     \
+        else                                                                                                          \
+            break;
+
+/**
+ * @brief Calls handler with the given @p index with @p args. Handlers are dispatched with switch statements
+ *    covering static_dispatch_cases handlers each (starting from @p Base) so that the compiler is able
+ *    to lower them to jump tables. The last handler is called for indices out of the range
+ */
+template<typename R, std::size_t Base, auto... Handlers, typename... Args>
+constexpr R static_dispatch(std::size_t index, Args&&... args) {
+
+    switch(index - Base) {
+        ESTD_STATIC_DISPATCH_CASE(0)
+        ESTD_STATIC_DISPATCH_CASE(1)
+        ESTD_STATIC_DISPATCH_CASE(2)
+        ESTD_STATIC_DISPATCH_CASE(3)
+        ESTD_STATIC_DISPATCH_CASE(4)
+        ESTD_STATIC_DISPATCH_CASE(5)
+        ESTD_STATIC_DISPATCH_CASE(6)
+        ESTD_STATIC_DISPATCH_CASE(7)
+        ESTD_STATIC_DISPATCH_CASE(8)
+        ESTD_STATIC_DISPATCH_CASE(9)
+        ESTD_STATIC_DISPATCH_CASE(10)
+        ESTD_STATIC_DISPATCH_CASE(11)
+        ESTD_STATIC_DISPATCH_CASE(12)
+        ESTD_STATIC_DISPATCH_CASE(13)
+        ESTD_STATIC_DISPATCH_CASE(14)
+        ESTD_STATIC_DISPATCH_CASE(15)
+        default:
+            break;
+    }
+
+    if constexpr (Base + static_dispatch_cases < sizeof...(Handlers)) {
+        if(index >= Base + static_dispatch_cases)
+            return static_dispatch<R, Base + static_dispatch_cases, Handlers...>(index, std::forward<Args>(args)...);
+    }
+
+    return static_cast<R>(std::invoke(
+        static_dispatch_handler<sizeof...(Handlers) - 1, Handlers...>(), std::forward<Args>(args)...));
+}
+
+#undef ESTD_STATIC_DISPATCH_CASE
+
+/* ================================================================================================================================ */
+
+} // End namespace estd::details
+
+/* ================================================================================================================================ */
+
+#endif
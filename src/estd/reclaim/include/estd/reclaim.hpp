@@ -0,0 +1,408 @@
+/* ============================================================================================================================ *//**
+ * @file       reclaim.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:37:12 pm
+ * @modified   Monday, 19th October 2026 1:37:12 pm
+ * @project    cpp-utils
+ * @brief      Safe memory reclamation for lock-free data structures - hazard pointers and epoch-based reclamation
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_RECLAIM_H__
+#define __ESTD_RECLAIM_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+// Private includes
+#include "estd/locks.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd::reclaim {
+
+/* ========================================================== Constants =========================================================== */
+
+/// Number of hazard pointers that a single thread may hold at once
+inline constexpr std::size_t hazard_pointers_per_thread = 8;
+
+/// Number of objects retired by the thread after which it tries to reclaim them
+inline constexpr std::size_t retire_batch = 64;
+
+/* ======================================================== Auxiliary types ======================================================= */
+
+namespace details {
+
+    /**
+     * @brief Object removed from the data structure waiting to be deleted
+     */
+    struct retired_object {
+
+        /// Retired object
+        void *object;
+
+        /// Function deleting the object
+        void (*deleter)(void *object);
+
+        /// Epoch the object has been retired in (epoch-based reclamation only)
+        std::uint64_t epoch;
+
+        /// Deletes the object
+        void reclaim() const { deleter(object); }
+
+    };
+
+    /// Deletes @p object of type @p T with the stateless @p Deleter
+    template<typename T, typename Deleter>
+    void delete_object(void *object) {
+        Deleter{ }(static_cast<T*>(object));
+    }
+
+    /**
+     * @brief Hazard pointers of the single thread
+     */
+    struct alignas(cache_line_size) hazard_record {
+
+        /// Published hazard pointers
+        std::array<std::atomic<const void*>, hazard_pointers_per_thread> hazards { };
+
+        /// Flag set while the record is owned by a living thread
+        std::atomic<bool> used { false };
+
+        /// Mask of unused hazard pointers (accessed by the owning thread only)
+        std::uint32_t free_hazards { (std::uint32_t{ 1 } << hazard_pointers_per_thread) - 1 };
+
+        /// Objects retired by the owning thread
+        std::vector<retired_object> retired;
+
+        /// Scratch buffer for the hazard pointers collected during the scan
+        std::vector<const void*> scanned;
+
+        /// Next record of the registry (immutable once the record is published)
+        hazard_record *next { nullptr };
+
+    };
+
+    /**
+     * @brief Read-side state of the single thread
+     */
+    struct alignas(cache_line_size) epoch_record {
+
+        /// Global epoch observed when the outermost critical section was entered (0 if the thread is quiescent)
+        std::atomic<std::uint64_t> epoch { 0 };
+
+        /// Flag set while the record is owned by a living thread
+        std::atomic<bool> used { false };
+
+        /// Depth of nested critical sections (accessed by the owning thread only)
+        unsigned nesting { 0 };
+
+        /// Objects retired by the owning thread
+        std::vector<retired_object> retired;
+
+        /// Next record of the registry (immutable once the record is published)
+        epoch_record *next { nullptr };
+
+    };
+
+    /**
+     * @brief Push-only list of per-thread records. Records of exited threads are reused (along with
+     *    objects they have left retired) by the threads started later
+     */
+    template<typename Record>
+    class thread_registry {
+    public:
+
+        thread_registry() = default;
+        thread_registry(const thread_registry &other) = delete;
+        thread_registry &operator=(const thread_registry &other) = delete;
+
+        /// Deletes records along with objects left retired in them
+        inline ~thread_registry();
+
+        /// @returns unused record owned by the calling thread from now on
+        inline Record &acquire();
+
+        /// Returns the @p record to the pool
+        inline void release(Record &record) noexcept;
+
+        /// Calls @p function with each record that is not owned by any thread (temporarily taking its ownership)
+        template<typename Function>
+        inline void for_each_orphan(Function &&function);
+
+        /// @returns first record of the registry
+        Record *front() const noexcept { return head.load(std::memory_order_acquire); }
+
+    private:
+
+        /// First record of the registry
+        std::atomic<Record*> head { nullptr };
+
+    };
+
+}
+
+/* ======================================================== Hazard pointers ======================================================= */
+
+/**
+ * @brief Process-wide domain of hazard pointers. Thread that wants to dereference a pointer loaded from
+ *    a shared location publishes it in the hazard_pointer first; retired objects are deleted only once
+ *    no thread publishes them. Bounds the number of unreclaimed objects regardless of stalled readers
+ *    at the cost of the store-load fence on each protected load.
+ *
+ * @note Each thread keeps its own retire list which is scanned against hazard pointers of all threads
+ *    every @ref retire_batch retirements
+ */
+class hazard_domain {
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    the global domain
+     */
+    static inline hazard_domain &global() noexcept;
+
+    /**
+     * @brief Retires @p object removed from the data structure. The object is deleted with the @p Deleter
+     *    once no hazard pointer refers to it
+     */
+    template<typename T, typename Deleter = std::default_delete<T>>
+        requires (std::is_empty_v<Deleter> and std::is_default_constructible_v<Deleter>)
+    inline void retire(T *object, Deleter deleter = Deleter{ });
+
+    /**
+     * @brief Deletes objects retired by the calling thread (and left by exited threads) that are not
+     *    protected by any hazard pointer
+     */
+    inline void reclaim();
+
+    /**
+     * @returns
+     *    number of objects retired by the calling thread and not deleted yet
+     */
+    inline std::size_t pending();
+
+private: /* -------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    friend class hazard_pointer;
+
+    hazard_domain() = default;
+
+    /// @returns record of the calling thread
+    inline details::hazard_record &this_thread_record();
+
+    /// Reclaims unprotected objects of the @p record
+    inline void scan(details::hazard_record &record);
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Records of threads
+    details::thread_registry<details::hazard_record> registry;
+
+};
+
+/**
+ * @brief RAII hazard pointer of the calling thread (at most @ref hazard_pointers_per_thread at once)
+ *
+ *    @code
+ *
+ *    estd::reclaim::hazard_pointer hazard;
+ *
+ *    node *top = hazard.protect(head);
+ *    while(top != nullptr and not head.compare_exchange_weak(top, top->next))
+ *        top = hazard.protect(head);
+ *
+ *    if(top != nullptr)
+ *        estd::reclaim::hazard_domain::global().retire(top);
+ *
+ *    @endcode
+ */
+class hazard_pointer {
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Acquires unused hazard pointer of the calling thread
+     */
+    inline hazard_pointer();
+
+    /**
+     * @brief Clears and releases the hazard pointer
+     */
+    inline ~hazard_pointer();
+
+    /// No copy-constructible
+    hazard_pointer(const hazard_pointer &other) = delete;
+    /// No copy-asignable
+    hazard_pointer &operator=(const hazard_pointer &other) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Loads the pointer from the @p source and protects it
+     * @returns
+     *    pointer that can be safely dereferenced until the hazard pointer is reset (or protects another
+     *    pointer)
+     */
+    template<typename T>
+    inline T *protect(const std::atomic<T*> &source) noexcept;
+
+    /**
+     * @brief Single attempt of protect() - protects the @p pointer and checks whether the @p source still
+     *    holds it
+     * @returns
+     *    @c true if the @p pointer has been protected; otherwise @p pointer is set to the current value
+     *    of the @p source (which is not protected)
+     */
+    template<typename T>
+    inline bool try_protect(T *&pointer, const std::atomic<T*> &source) noexcept;
+
+    /**
+     * @brief Clears the hazard pointer
+     */
+    inline void reset() noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Record the hazard pointer belongs to
+    details::hazard_record *record;
+
+    /// Index of the hazard pointer in the record
+    unsigned index;
+
+};
+
+/* =================================================== Epoch-based reclamation ==================================================== */
+
+/**
+ * @brief Process-wide domain of the epoch-based reclamation. Readers enter critical sections (epoch_guard)
+ *    that only publish the observed global epoch, so reads are cheaper than with hazard pointers, but
+ *    a stalled reader blocks reclamation of all objects retired after it has entered its section.
+ *
+ * @note Each thread keeps its own retire list; objects are tagged with the epoch they were retired in
+ *    and deleted once the global epoch has advanced twice since then. The epoch advances only when all
+ *    threads inside critical sections have observed the current one
+ */
+class epoch_domain {
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    the global domain
+     */
+    static inline epoch_domain &global() noexcept;
+
+    /**
+     * @brief Retires @p object removed from the data structure. The object is deleted with the @p Deleter
+     *    once no critical section that could have observed it remains
+     */
+    template<typename T, typename Deleter = std::default_delete<T>>
+        requires (std::is_empty_v<Deleter> and std::is_default_constructible_v<Deleter>)
+    inline void retire(T *object, Deleter deleter = Deleter{ });
+
+    /**
+     * @brief Tries to advance the global epoch and deletes objects retired by the calling thread (and left
+     *    by exited threads) whose grace period has elapsed
+     */
+    inline void reclaim();
+
+    /**
+     * @brief Waits until all objects retired by the calling thread are deleted
+     * @note Must not be called from inside the critical section
+     */
+    inline void synchronize();
+
+    /**
+     * @returns
+     *    number of objects retired by the calling thread and not deleted yet
+     */
+    inline std::size_t pending();
+
+private: /* -------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    friend class epoch_guard;
+
+    epoch_domain() = default;
+
+    /// @returns record of the calling thread
+    inline details::epoch_record &this_thread_record();
+
+    /// Advances the global epoch if all threads in critical sections have observed the current one
+    inline void try_advance() noexcept;
+
+    /// Deletes objects of the @p record whose grace period has elapsed
+    inline void collect(details::epoch_record &record);
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Global epoch (starts from 1 as 0 marks quiescent records)
+    std::atomic<std::uint64_t> epoch { 1 };
+
+    /// Records of threads
+    details::thread_registry<details::epoch_record> registry;
+
+};
+
+/**
+ * @brief RAII critical section of the epoch-based reclamation. Pointers loaded inside the section can be
+ *    dereferenced until the section ends (sections may be nested)
+ */
+class epoch_guard {
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Enters the critical section
+     */
+    inline epoch_guard();
+
+    /**
+     * @brief Leaves the critical section
+     */
+    inline ~epoch_guard();
+
+    /// No copy-constructible
+    epoch_guard(const epoch_guard &other) = delete;
+    /// No copy-asignable
+    epoch_guard &operator=(const epoch_guard &other) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Loads the pointer from the @p source
+     * @returns
+     *    pointer that can be safely dereferenced until the guard is destroyed
+     */
+    template<typename T>
+    T *protect(const std::atomic<T*> &source) const noexcept { return source.load(std::memory_order_acquire); }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Record of the calling thread
+    details::epoch_record *record;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd::reclaim
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/reclaim/reclaim.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
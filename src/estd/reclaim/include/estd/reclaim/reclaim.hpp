@@ -0,0 +1,373 @@
+/* ============================================================================================================================ *//**
+ * @file       reclaim.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:37:12 pm
+ * @modified   Monday, 19th October 2026 1:37:12 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the safe memory reclamation domains
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_RECLAIM_RECLAIM_H__
+#define __ESTD_RECLAIM_RECLAIM_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <iterator>
+#include <utility>
+// Private includes
+#include "estd/reclaim.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd::reclaim {
+
+/* ======================================================== Auxiliary types ======================================================= */
+
+namespace details {
+
+    template<typename Record>
+    thread_registry<Record>::~thread_registry() {
+        for(auto *record = head.load(std::memory_order_acquire); record != nullptr;) {
+            for(auto &object : record->retired)
+                object.reclaim();
+            delete std::exchange(record, record->next);
+        }
+    }
+
+
+    template<typename Record>
+    Record &thread_registry<Record>::acquire() {
+
+        // Reuse record of the thread that has exited
+        for(auto *record = head.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            bool expected = false;
+            if(not record->used.load(std::memory_order_relaxed) and
+                record->used.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return *record;
+            }
+        }
+
+        auto *record = new Record;
+        record->used.store(true, std::memory_order_relaxed);
+
+        record->next = head.load(std::memory_order_relaxed);
+        while(not head.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed));
+
+        return *record;
+    }
+
+
+    template<typename Record>
+    void thread_registry<Record>::release(Record &record) noexcept {
+        record.used.store(false, std::memory_order_release);
+    }
+
+
+    template<typename Record>
+    template<typename Function>
+    void thread_registry<Record>::for_each_orphan(Function &&function) {
+        for(auto *record = head.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            bool expected = false;
+            if(not record->used.load(std::memory_order_relaxed) and
+                record->used.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                function(*record);
+                release(*record);
+            }
+        }
+    }
+
+    /**
+     * @brief Deletes objects from the @p retired list for which @p reclaimable returns @c true
+     * @note Objects are removed from the list before being deleted, so that their destructors may retire
+     *    other objects
+     */
+    template<typename Predicate>
+    void reclaim_if(std::vector<retired_object> &retired, Predicate &&reclaimable) {
+
+        auto first = std::partition(retired.begin(), retired.end(), [&reclaimable](const retired_object &object) {
+            return not reclaimable(object);
+        });
+
+        if(first == retired.end())
+            return;
+
+        std::vector<retired_object> reclaimed {
+            std::make_move_iterator(first),
+            std::make_move_iterator(retired.end())
+        };
+        retired.erase(first, retired.end());
+
+        for(auto &object : reclaimed)
+            object.reclaim();
+    }
+
+}
+
+/* ======================================================== hazard_domain ========================================================= */
+
+hazard_domain &hazard_domain::global() noexcept {
+    static hazard_domain instance;
+    return instance;
+}
+
+
+template<typename T, typename Deleter>
+    requires (std::is_empty_v<Deleter> and std::is_default_constructible_v<Deleter>)
+void hazard_domain::retire(T *object, Deleter) {
+
+    auto &record = this_thread_record();
+
+    record.retired.push_back(details::retired_object{ object, &details::delete_object<T, Deleter>, 0 });
+
+    // Scans are batched to amortize the cost of collecting hazard pointers of all threads
+    if(record.retired.size() >= retire_batch)
+        scan(record);
+}
+
+
+void hazard_domain::reclaim() {
+    scan(this_thread_record());
+    registry.for_each_orphan([this](details::hazard_record &record) { scan(record); });
+}
+
+
+std::size_t hazard_domain::pending() {
+    return this_thread_record().retired.size();
+}
+
+
+details::hazard_record &hazard_domain::this_thread_record() {
+
+    /**
+     * @brief Owner of the calling thread's record returning it to the domain on thread's exit
+     */
+    struct record_owner {
+
+        record_owner() : record{ global().registry.acquire() } { }
+
+        ~record_owner() {
+            // Objects that are still protected are left for the thread that reuses the record
+            global().scan(record);
+            global().registry.release(record);
+        }
+
+        details::hazard_record &record;
+    };
+
+    thread_local record_owner owner;
+
+    return owner.record;
+}
+
+
+void hazard_domain::scan(details::hazard_record &record) {
+
+    if(record.retired.empty())
+        return;
+
+    // Orders removal of retired objects from data structures before loads of hazard pointers
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    auto &scanned = record.scanned;
+
+    scanned.clear();
+    for(auto *other = registry.front(); other != nullptr; other = other->next) {
+        for(auto &hazard : other->hazards) {
+            if(const void *pointer = hazard.load(std::memory_order_seq_cst); pointer != nullptr)
+                scanned.push_back(pointer);
+        }
+    }
+
+    std::sort(scanned.begin(), scanned.end());
+
+    details::reclaim_if(record.retired, [&scanned](const details::retired_object &object) {
+        return not std::binary_search(scanned.begin(), scanned.end(), static_cast<const void*>(object.object));
+    });
+}
+
+/* ======================================================== hazard_pointer ======================================================== */
+
+hazard_pointer::hazard_pointer() :
+    record{ &hazard_domain::global().this_thread_record() }
+{
+    assert(record->free_hazards != 0 and "Too many hazard pointers held by the thread");
+
+    index = static_cast<unsigned>(std::countr_zero(record->free_hazards));
+
+    record->free_hazards &= ~(std::uint32_t{ 1 } << index);
+}
+
+
+hazard_pointer::~hazard_pointer() {
+
+    reset();
+
+    record->free_hazards |= (std::uint32_t{ 1 } << index);
+}
+
+
+template<typename T>
+T *hazard_pointer::protect(const std::atomic<T*> &source) noexcept {
+
+    T *pointer = source.load(std::memory_order_relaxed);
+
+    while(not try_protect(pointer, source));
+
+    return pointer;
+}
+
+
+template<typename T>
+bool hazard_pointer::try_protect(T *&pointer, const std::atomic<T*> &source) noexcept {
+
+    record->hazards[index].store(pointer, std::memory_order_seq_cst);
+
+    // Pointer is protected only if it has not been removed before the hazard pointer was published
+    T *current = source.load(std::memory_order_seq_cst);
+    if(current == pointer)
+        return true;
+
+    pointer = current;
+
+    return false;
+}
+
+
+void hazard_pointer::reset() noexcept {
+    record->hazards[index].store(nullptr, std::memory_order_release);
+}
+
+/* ========================================================= epoch_domain ========================================================= */
+
+epoch_domain &epoch_domain::global() noexcept {
+    static epoch_domain instance;
+    return instance;
+}
+
+
+template<typename T, typename Deleter>
+    requires (std::is_empty_v<Deleter> and std::is_default_constructible_v<Deleter>)
+void epoch_domain::retire(T *object, Deleter) {
+
+    auto &record = this_thread_record();
+
+    // Readers that could have observed the object have entered their sections in this epoch or earlier
+    record.retired.push_back(details::retired_object{
+        object, &details::delete_object<T, Deleter>, epoch.load(std::memory_order_seq_cst)
+    });
+
+    if(record.retired.size() >= retire_batch)
+        reclaim();
+}
+
+
+void epoch_domain::reclaim() {
+    try_advance();
+    collect(this_thread_record());
+    registry.for_each_orphan([this](details::epoch_record &record) { collect(record); });
+}
+
+
+void epoch_domain::synchronize() {
+
+    auto &record = this_thread_record();
+
+    // Thread inside the critical section would wait for itself
+    assert(record.nesting == 0);
+
+    spin_backoff backoff;
+
+    for(reclaim(); not record.retired.empty(); reclaim())
+        backoff();
+}
+
+
+std::size_t epoch_domain::pending() {
+    return this_thread_record().retired.size();
+}
+
+
+details::epoch_record &epoch_domain::this_thread_record() {
+
+    /**
+     * @brief Owner of the calling thread's record returning it to the domain on thread's exit
+     */
+    struct record_owner {
+
+        record_owner() : record{ global().registry.acquire() } { }
+
+        ~record_owner() {
+            assert(record.nesting == 0);
+            // Objects whose grace period has not elapsed yet are left for the thread that reuses the record
+            global().reclaim();
+            global().registry.release(record);
+        }
+
+        details::epoch_record &record;
+    };
+
+    thread_local record_owner owner;
+
+    return owner.record;
+}
+
+
+void epoch_domain::try_advance() noexcept {
+
+    std::uint64_t current = epoch.load(std::memory_order_seq_cst);
+
+    for(auto *record = registry.front(); record != nullptr; record = record->next) {
+        if(std::uint64_t observed = record->epoch.load(std::memory_order_seq_cst); observed != 0 and observed != current)
+            return;
+    }
+
+    epoch.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
+
+
+void epoch_domain::collect(details::epoch_record &record) {
+
+    std::uint64_t current = epoch.load(std::memory_order_acquire);
+
+    /**
+     * Reader that might have observed the object retired in the epoch E has entered its section in E or
+     * earlier and the epoch cannot advance past E + 1 while it stays there
+     */
+    details::reclaim_if(record.retired, [current](const details::retired_object &object) {
+        return object.epoch + 2 <= current;
+    });
+}
+
+/* ========================================================== epoch_guard ========================================================= */
+
+epoch_guard::epoch_guard() :
+    record{ &epoch_domain::global().this_thread_record() }
+{
+    // Only the outermost section is recorded
+    if(record->nesting++ == 0)
+        record->epoch.store(epoch_domain::global().epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+}
+
+
+epoch_guard::~epoch_guard() {
+    if(--record->nesting == 0)
+        record->epoch.store(0, std::memory_order_release);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd::reclaim
+
+/* ================================================================================================================================ */
+
+#endif
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Sunday, 25th July 2021 8:44:05 pm
- * @modified   Sunday, 26th June 2022 11:56:58 am
+ * @modified   Monday, 19th October 2026 5:02:13 pm
  * @project    cpp-utils
  * @brief      Aggregating file for `result` library
  * 
@@ -18,6 +18,7 @@
 
 #include "estd/result/default_domain.hpp"
 #include "estd/result/domain_descriptor.hpp"
+#include "estd/result/domain_registry.hpp"
 #include "estd/result/result_code.hpp"
 #include "estd/result/result.hpp"
 #include "estd/result/status_code.hpp"
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Tuesday, 15th June 2021 8:53:35 pm
- * @modified   Tuesday, 28th February 2023 8:58:14 pm
+ * @modified   Monday, 19th October 2026 5:02:13 pm
  * @project    cpp-utils
  * @brief      Declarations of default domain symbol's
  * 
@@ -56,6 +56,8 @@ enum class Warning : uint32_t {
     TooLate         // Action could not be finalized as some condition was stolen in the meanwhile
 };
 
+// Index of the global namespace's domain (reserved)
+constexpr domain_index DefaultDomainIndex = 0;
 // Object used as a domain's reference point
 extern const domain_descriptor DefaultDomainDescriptor;
 // Global namespace's domain ID
@@ -75,6 +77,9 @@ inline constexpr std::string_view to_string(const status_code &status);
 
 // Descriptor of status codes from the global namespace
 constexpr domain_descriptor DefaultDomainDescriptor(
+
+    /* ------ Domain index ------- */
+    DefaultDomainIndex,
     
     /* ------ Success codes ------ */
     domain_descriptor::empty_table(),
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Tuesday, 20th July 2021 10:39:30 pm
- * @modified   Sunday, 26th June 2022 11:56:59 am
+ * @modified   Monday, 19th October 2026 8:58:21 pm
  * @project    cpp-utils
  * @brief      Class representing the domain_descriptor
  * 
@@ -16,6 +16,9 @@
 
 /* =========================================================== Includes =========================================================== */
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <span>
 #include "estd/result/status_code.hpp"
 
@@ -29,6 +32,22 @@ namespace estd {
 class domain_descriptor;
 // Category of the variables used to represent status domain
 using domain_id = const domain_descriptor *;
+// Category of the small index identifying the domain inside the packed status
+using domain_index = uint16_t;
+
+// Maximal number of domains that can be registered (indices of domains must be smaller)
+constexpr std::size_t max_domains = 256;
+// Index stored by statuses created with the @c nullptr domain (never taken by any descriptor)
+constexpr domain_index NullDomainIndex = domain_index(max_domains);
+
+namespace details {
+
+    // Reports index of the domain out of range (not constexpr, so that it fails constant evaluation of the descriptor)
+    inline void domain_index_out_of_range() noexcept {
+        assert(false && "[estd::domain_descriptor] Index of the domain must be smaller than estd::max_domains");
+    }
+
+}
 
 /**
  * @brief Class representing a status domain's descriptor
@@ -45,6 +64,9 @@ public:
 
     /**
      * @brief Domain descriptor's constructor
+     * @param index
+     *    index of the domain unique across the application (index 0 is reserved for the default domain); indices
+     *    not smaller than @ref max_domains are rejected at compile time for constexpr descriptors
      * @param success_description_table
      *    table of description strings for success status codes
      * @param warning_description_table
@@ -53,6 +75,7 @@ public:
      *    table of description strings for error status codes
      */
     inline constexpr domain_descriptor(
+        domain_index index,
         std::span<const char *> success_description_table,
         std::span<const char *> warning_description_table,
         std::span<const char *> error_description_table
@@ -76,8 +99,17 @@ public:
      */
     inline constexpr domain_id getDomainID() const;
 
+    /**
+     * @returns 
+     *    index of the domain
+     */
+    inline constexpr domain_index getIndex() const;
+
 private:
 
+    // Index of the domain
+    domain_index index;
+
     // Table of descriptions for success status codes
     std::span<const char *> success;
     // Table of descriptions for warning status codes
@@ -91,7 +123,7 @@ private:
  * @brief Converts domain_descriptor into domain_id
  * 
  * @param descriptor 
- *    descriptor to be converted
+ *    descriptor to be converted (must not be @c nullptr)
  * @returns 
  *    domain's ID
  */
@@ -0,0 +1,78 @@
+/* ============================================================================================================================ *//**
+ * @file       domain_registry.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 5:02:13 pm
+ * @modified   Monday, 19th October 2026 8:58:21 pm
+ * @project    cpp-utils
+ * @brief      Registry mapping indices of status domains back to their descriptors. Statuses store only the small index of
+ *             their domain, so the descriptor (and so human-readable descriptions of codes) is looked up here when needed.
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_RESULT_DOMAIN_REGISTRY_H__
+#define __ESTD_RESULT_DOMAIN_REGISTRY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include "estd/result/default_domain.hpp"
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace estd {
+
+/* ========================================================= Declarations ========================================================= */
+
+namespace details {
+
+    // Descriptors of registered domains indexed by domain's index (default domain is registered statically)
+    inline constinit std::array<std::atomic<domain_id>, max_domains> domain_registry { DefaultDomain };
+
+}
+
+/**
+ * @brief Registers the @p descriptor so that statuses of its domain can be mapped back to it. Domains must be
+ *    registered before their statuses are inspected, e.g. at static initialization:
+ *
+ *    @code
+ *    inline const bool MyDomainRegistered = estd::register_domain(MyDomainDescriptor);
+ *    @endcode
+ *
+ * @note Statuses identify their domain only by its index. Statuses of two domains sharing the index compare
+ *    equal and are described by the domain registered first, so taking an index of another domain is
+ *    a programming error (asserted)
+ * @param descriptor
+ *    descriptor to be registered; it must outlive all statuses of its domain
+ * @returns
+ *    @c true if @p descriptor is registered under its index \n
+ *    @c false if the index is out of range or has already been taken by another domain
+ */
+[[nodiscard]] inline bool register_domain(const domain_descriptor &descriptor) noexcept;
+
+/**
+ * @brief Looks up domain registered under the given @p index
+ * @note During constant evaluation only the default domain can be found
+ * @param index
+ *    index of the domain
+ * @returns
+ *    ID of the domain registered under @p index \n
+ *    @c nullptr if no domain has been registered under @p index
+ */
+inline constexpr domain_id find_domain(domain_index index) noexcept;
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation Includes =================================================== */
+
+#include "estd/result/impl/domain_registry.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Tuesday, 13th July 2021 7:57:43 am
- * @modified   Sunday, 26th June 2022 11:56:59 am
+ * @modified   Monday, 19th October 2026 8:58:21 pm
  * @project    cpp-utils
  * @brief      Implementation of functions and of the DomainDescriptr class
  * 
@@ -25,14 +25,19 @@ namespace estd {
 /* ====================================================== Public constructors ===================================================== */
 
 constexpr domain_descriptor::domain_descriptor(
+    domain_index index,
     std::span<const char *> success_description_table,
     std::span<const char *> warning_description_table,
     std::span<const char *> error_description_table
 ) : 
+    index(index),
     success(success_description_table),
     warning(warning_description_table),
     error(error_description_table)
-{}
+{
+    if(index >= max_domains)
+        details::domain_index_out_of_range();
+}
 
 
 /* ======================================================== Public methods ======================================================== */
@@ -52,6 +57,11 @@ constexpr domain_id domain_descriptor::getDomainID() const {
     return this;
 }
 
+
+constexpr domain_index domain_descriptor::getIndex() const {
+    return index;
+}
+
 /* ===================================================== Public static methods ==================================================== */
 
 constexpr const domain_descriptor & get_domain_descriptor(domain_id domain) {
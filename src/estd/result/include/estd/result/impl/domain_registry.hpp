@@ -0,0 +1,61 @@
+/* ============================================================================================================================ *//**
+ * @file       domain_registry.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 5:02:13 pm
+ * @modified   Monday, 19th October 2026 8:58:21 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the status domains' registry
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_RESULT_IMPL_DOMAIN_REGISTRY_H__
+#define __ESTD_RESULT_IMPL_DOMAIN_REGISTRY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <cassert>
+#include <type_traits>
+#include "estd/result/domain_registry.hpp"
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace estd {
+
+/* ========================================================== Definitions ========================================================= */
+
+bool register_domain(const domain_descriptor &descriptor) noexcept {
+
+    if(descriptor.getIndex() >= max_domains)
+        return false;
+
+    domain_id expected = nullptr;
+
+    // Registering the same descriptor twice is fine, only taking index of another domain fails
+    bool registered = details::domain_registry[descriptor.getIndex()].compare_exchange_strong(expected, descriptor.getDomainID(),
+        std::memory_order_acq_rel, std::memory_order_acquire) or expected == descriptor.getDomainID();
+
+    assert(registered && "[estd::register_domain] Index of the domain has already been taken by another domain");
+
+    return registered;
+}
+
+
+constexpr domain_id find_domain(domain_index index) noexcept {
+
+    // Registry is not accessible at compile time
+    if(std::is_constant_evaluated())
+        return (index == DefaultDomainIndex) ? DefaultDomain : nullptr;
+
+    return (index < max_domains) ? details::domain_registry[index].load(std::memory_order_acquire) : nullptr;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
@@ -3,11 +3,11 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Tuesday, 13th July 2021 9:00:51 am
- * @modified   Tuesday, 28th February 2023 9:01:39 pm
+ * @modified   Monday, 19th October 2026 6:41:27 pm
  * @project    cpp-utils
  * @brief      Implementation of inline methods and methods templates related to result class template
- * 
- * 
+ *
+ *
  * @copyright Krzysztof Pierczyk © 2022
  */// ============================================================================================================================= */
 
@@ -16,36 +16,201 @@
 
 /* =========================================================== Includes =========================================================== */
 
+#include <cassert>
+#include <functional>
+#include <memory>
 #include "estd/result/result.hpp"
 
 /* =========================================================== Namespace ========================================================== */
 
 namespace estd {
 
+/* ============================================================ failure =========================================================== */
+
+constexpr failure::failure(const status &status_p) noexcept :
+    _status(status_p)
+{
+    assert(status_p.category() == status_code::Category::Error and "[estd::failure] Only error statuses can be propagated");
+
+    // Never let the non-error status reach the result without constructing its value
+    if(_status.category() != status_code::Category::Error)
+        _status = status::error(DefaultDomain, Error::Unknown);
+}
+
+
+constexpr failure::operator const status &() const noexcept {
+    return _status;
+}
+
 /* ====================================================== Public constructors ===================================================== */
 
 template<typename ResultType>
-constexpr result<ResultType>::result(const status &status_p) noexcept : 
-    _status(status_p), _value()
-{}
+constexpr result<ResultType>::result(const status &status_p)
+    noexcept(std::is_nothrow_default_constructible_v<ResultType>)
+    requires std::is_default_constructible_v<ResultType> :
+    _status(status_p)
+{
+    if(has_value())
+        construct();
+}
+
+
+template<typename ResultType>
+constexpr result<ResultType>::result(const failure &failure_p) noexcept :
+    _status(failure_p._status)
+{ }
+
+
+template<typename ResultType>
+constexpr result<ResultType>::result(const ResultType &value_p, const status &status_p)
+    noexcept(std::is_nothrow_copy_constructible_v<ResultType>) :
+    _status(status_p)
+{
+    if(has_value())
+        construct(value_p);
+}
+
+
+template<typename ResultType>
+constexpr result<ResultType>::result(ResultType &&value_p, const status &status_p)
+    noexcept(std::is_nothrow_move_constructible_v<ResultType>) :
+    _status(status_p)
+{
+    if(has_value())
+        construct(std::move(value_p));
+}
+
+
+template<typename ResultType>
+template<typename... Args>
+    requires std::is_constructible_v<ResultType, Args&&...>
+constexpr result<ResultType>::result(std::in_place_t, Args&&... args)
+    noexcept(std::is_nothrow_constructible_v<ResultType, Args&&...>) :
+    _status(status::success()),
+    _value(std::forward<Args>(args)...)
+{ }
 
 
 template<typename ResultType>
-constexpr result<ResultType>::result(const ResultType &value_p, const status &status_p) noexcept : 
-    _status(status_p), _value(value_p)
-{}
+constexpr result<ResultType>::result(const result &rresult)
+    noexcept(std::is_nothrow_copy_constructible_v<ResultType>)
+    requires (not std::is_trivially_copy_constructible_v<ResultType>) :
+    _status(rresult._status)
+{
+    if(has_value())
+        construct(rresult._value);
+}
+
+
+template<typename ResultType>
+constexpr result<ResultType>::result(result &&rresult)
+    noexcept(std::is_nothrow_move_constructible_v<ResultType>)
+    requires (not std::is_trivially_move_constructible_v<ResultType>) :
+    _status(rresult._status)
+{
+    if(has_value())
+        construct(std::move(rresult._value));
+}
+
+
+template<typename ResultType>
+constexpr result<ResultType>::~result() requires (not std::is_trivially_destructible_v<ResultType>) {
+    if(has_value())
+        destroy();
+}
 
 /* ======================================================= Public operators ======================================================= */
 
 template<typename ResultType>
-constexpr result<ResultType> &result<ResultType>::operator=(const ResultType &rvalue) noexcept {
-    _value = rvalue;
+constexpr result<ResultType> &result<ResultType>::operator=(const result &rresult)
+    noexcept(std::is_nothrow_copy_constructible_v<ResultType> and std::is_nothrow_copy_assignable_v<ResultType>)
+    requires (not trivially_copy_assignable)
+{
+    if(has_value() and rresult.has_value())
+        _value = rresult._value;
+    else if(has_value())
+        destroy();
+    else if(rresult.has_value())
+        construct(rresult._value);
+
+    _status = rresult._status;
+
+    return *this;
+}
+
+
+template<typename ResultType>
+constexpr result<ResultType> &result<ResultType>::operator=(result &&rresult)
+    noexcept(std::is_nothrow_move_constructible_v<ResultType> and std::is_nothrow_move_assignable_v<ResultType>)
+    requires (not trivially_move_assignable)
+{
+    if(has_value() and rresult.has_value())
+        _value = std::move(rresult._value);
+    else if(has_value())
+        destroy();
+    else if(rresult.has_value())
+        construct(std::move(rresult._value));
+
+    _status = rresult._status;
+
+    return *this;
 }
 
 
 template<typename ResultType>
-constexpr result<ResultType> &result<ResultType>::operator=(const status &status_p) noexcept {
-    this->_status = status_p;
+constexpr result<ResultType> &result<ResultType>::operator=(const ResultType &rvalue) {
+
+    if(has_value()) {
+        _value = rvalue;
+    } else {
+        construct(rvalue);
+        _status = status::success();
+    }
+
+    return *this;
+}
+
+
+template<typename ResultType>
+constexpr result<ResultType> &result<ResultType>::operator=(ResultType &&rvalue) {
+
+    if(has_value()) {
+        _value = std::move(rvalue);
+    } else {
+        construct(std::move(rvalue));
+        _status = status::success();
+    }
+
+    return *this;
+}
+
+
+template<typename ResultType>
+constexpr result<ResultType> &result<ResultType>::operator=(const status &status_p)
+    noexcept(std::is_nothrow_default_constructible_v<ResultType>)
+    requires std::is_default_constructible_v<ResultType>
+{
+    bool had_value = has_value();
+
+    if(had_value and status_p.category() == status_code::Category::Error)
+        destroy();
+    else if(not had_value and status_p.category() != status_code::Category::Error)
+        construct();
+
+    // Status is updated after the value is constructed, so that the result stays valid if construction throws
+    _status = status_p;
+
+    return *this;
+}
+
+
+template<typename ResultType>
+template<typename Enum>
+    requires (std::is_enum_v<Enum> and std::is_default_constructible_v<ResultType>)
+constexpr result<ResultType> &result<ResultType>::operator=(const Enum &status_p)
+    noexcept(std::is_nothrow_default_constructible_v<ResultType>)
+{
+    return *this = status(status_p);
 }
 
 
@@ -56,8 +221,18 @@ constexpr result<ResultType>::operator bool() const noexcept {
 
 
 template<typename ResultType>
-constexpr bool result<ResultType>::operator==(const ResultType &rvalue) const noexcept {
-    return _value == rvalue;
+constexpr bool result<ResultType>::operator==(const result &rresult) const noexcept
+    requires std::equality_comparable<ResultType>
+{
+    return (_status == rresult._status) and (not has_value() or _value == rresult._value);
+}
+
+
+template<typename ResultType>
+constexpr bool result<ResultType>::operator==(const ResultType &rvalue) const noexcept
+    requires std::equality_comparable<ResultType>
+{
+    return has_value() and _value == rvalue;
 }
 
 
@@ -71,76 +246,255 @@ template<typename ResultType>
 template<typename Enum>
     requires std::is_enum_v<Enum>
 constexpr bool result<ResultType>::operator==(const Enum &status_p) const noexcept {
-    return this->_status == _status(status_p);
+    return this->_status == status_p;
 }
 
 
 template<typename ResultType>
-constexpr bool result<ResultType>::operator!=(const ResultType &value_p) const noexcept {
-    return !(*this == value_p);
+constexpr ResultType &result<ResultType>::operator*() & noexcept {
+    return value();
 }
 
 
 template<typename ResultType>
-constexpr bool result<ResultType>::operator!=(const status &status_p) const noexcept {
-    return !(*this == status_p);
+constexpr const ResultType &result<ResultType>::operator*() const & noexcept {
+    return value();
 }
 
 
 template<typename ResultType>
-template<typename Enum>
-    requires std::is_enum_v<Enum>
-constexpr bool result<ResultType>::operator!=(const Enum &status_p) const noexcept {
-    return !(*this == status_p);
+constexpr ResultType &&result<ResultType>::operator*() && noexcept {
+    return std::move(*this).value();
+}
+
+
+template<typename ResultType>
+constexpr ResultType *result<ResultType>::operator->() noexcept {
+    return &value();
+}
+
+
+template<typename ResultType>
+constexpr const ResultType *result<ResultType>::operator->() const noexcept {
+    return &value();
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename ResultType>
+constexpr bool result<ResultType>::has_value() const noexcept {
+    return _status.category() != status_code::Category::Error;
+}
+
+
+template<typename ResultType>
+constexpr ResultType &result<ResultType>::value() & noexcept {
+    assert(has_value());
+    return _value;
+}
+
+
+template<typename ResultType>
+constexpr const ResultType &result<ResultType>::value() const & noexcept {
+    assert(has_value());
+    return _value;
+}
+
+
+template<typename ResultType>
+constexpr ResultType &&result<ResultType>::value() && noexcept {
+    assert(has_value());
+    return std::move(_value);
+}
+
+
+template<typename ResultType>
+template<typename U>
+    requires std::is_convertible_v<U&&, ResultType>
+constexpr ResultType result<ResultType>::value_or(U &&default_value) const & {
+    return has_value() ? _value : static_cast<ResultType>(std::forward<U>(default_value));
+}
+
+
+template<typename ResultType>
+template<typename U>
+    requires std::is_convertible_v<U&&, ResultType>
+constexpr ResultType result<ResultType>::value_or(U &&default_value) && {
+    return has_value() ? std::move(_value) : static_cast<ResultType>(std::forward<U>(default_value));
+}
+
+
+template<typename ResultType>
+template<typename Function>
+    requires details::is_result_v<std::invoke_result_t<Function, ResultType&>>
+constexpr auto result<ResultType>::and_then(Function &&function) & {
+
+    using Result = std::remove_cvref_t<std::invoke_result_t<Function, ResultType&>>;
+
+    if(has_value())
+        return std::invoke(std::forward<Function>(function), _value);
+
+    return Result(failure(_status));
+}
+
+
+template<typename ResultType>
+template<typename Function>
+    requires details::is_result_v<std::invoke_result_t<Function, const ResultType&>>
+constexpr auto result<ResultType>::and_then(Function &&function) const & {
+
+    using Result = std::remove_cvref_t<std::invoke_result_t<Function, const ResultType&>>;
+
+    if(has_value())
+        return std::invoke(std::forward<Function>(function), _value);
+
+    return Result(failure(_status));
+}
+
+
+template<typename ResultType>
+template<typename Function>
+    requires details::is_result_v<std::invoke_result_t<Function, ResultType&&>>
+constexpr auto result<ResultType>::and_then(Function &&function) && {
+
+    using Result = std::remove_cvref_t<std::invoke_result_t<Function, ResultType&&>>;
+
+    if(has_value())
+        return std::invoke(std::forward<Function>(function), std::move(_value));
+
+    return Result(failure(_status));
+}
+
+
+template<typename ResultType>
+template<typename Function>
+    requires std::is_invocable_v<Function, ResultType&>
+constexpr auto result<ResultType>::map(Function &&function) & {
+
+    using Value = std::remove_cvref_t<std::invoke_result_t<Function, ResultType&>>;
+
+    if constexpr(std::is_void_v<Value>) {
+        if(has_value())
+            std::invoke(std::forward<Function>(function), _value);
+        return result<void>(_status);
+    } else {
+        if(has_value())
+            return result<Value>(std::invoke(std::forward<Function>(function), _value), _status);
+        return result<Value>(failure(_status));
+    }
+}
+
+
+template<typename ResultType>
+template<typename Function>
+    requires std::is_invocable_v<Function, const ResultType&>
+constexpr auto result<ResultType>::map(Function &&function) const & {
+
+    using Value = std::remove_cvref_t<std::invoke_result_t<Function, const ResultType&>>;
+
+    if constexpr(std::is_void_v<Value>) {
+        if(has_value())
+            std::invoke(std::forward<Function>(function), _value);
+        return result<void>(_status);
+    } else {
+        if(has_value())
+            return result<Value>(std::invoke(std::forward<Function>(function), _value), _status);
+        return result<Value>(failure(_status));
+    }
+}
+
+
+template<typename ResultType>
+template<typename Function>
+    requires std::is_invocable_v<Function, ResultType&&>
+constexpr auto result<ResultType>::map(Function &&function) && {
+
+    using Value = std::remove_cvref_t<std::invoke_result_t<Function, ResultType&&>>;
+
+    if constexpr(std::is_void_v<Value>) {
+        if(has_value())
+            std::invoke(std::forward<Function>(function), std::move(_value));
+        return result<void>(_status);
+    } else {
+        if(has_value())
+            return result<Value>(std::invoke(std::forward<Function>(function), std::move(_value)), _status);
+        return result<Value>(failure(_status));
+    }
+}
+
+
+template<typename ResultType>
+template<typename Function>
+    requires std::is_same_v<std::remove_cvref_t<std::invoke_result_t<Function, const status&>>, result<ResultType>>
+constexpr result<ResultType> result<ResultType>::or_else(Function &&function) const & {
+
+    if(has_value())
+        return *this;
+
+    return std::invoke(std::forward<Function>(function), _status);
+}
+
+
+template<typename ResultType>
+template<typename Function>
+    requires std::is_same_v<std::remove_cvref_t<std::invoke_result_t<Function, const status&>>, result<ResultType>>
+constexpr result<ResultType> result<ResultType>::or_else(Function &&function) && {
+
+    if(has_value())
+        return std::move(*this);
+
+    return std::invoke(std::forward<Function>(function), _status);
 }
 
 /* ===================================================== Public static methods ==================================================== */
 
 template<typename ResultType>
+template<typename U>
+    requires std::is_constructible_v<ResultType, U&&>
 constexpr result<ResultType> result<ResultType>::success(
-    const ResultType &value_p
-) noexcept {
-    return result(value_p, status::success(DefaultDomain, 0));
+    U &&value_p
+) noexcept(std::is_nothrow_constructible_v<ResultType, U&&>) {
+    return result(ResultType(std::forward<U>(value_p)), status::success(DefaultDomain, 0));
 }
 
 
 template<typename ResultType>
-template<typename Enum>
-    requires std::is_enum_v<Enum>
+template<typename Enum, typename U>
+    requires (std::is_enum_v<Enum> and std::is_constructible_v<ResultType, U&&>)
 constexpr result<ResultType> result<ResultType>::success(
     domain_id domain,
     Enum code,
-    const ResultType &value_p
-) noexcept {
-    return result(value_p, status::success(domain, code));
+    U &&value_p
+) noexcept(std::is_nothrow_constructible_v<ResultType, U&&>) {
+    return result(ResultType(std::forward<U>(value_p)), status::success(domain, code));
 }
 
 
 template<typename ResultType>
+template<typename U>
+    requires std::is_constructible_v<ResultType, U&&>
 constexpr result<ResultType> result<ResultType>::warning(
-    const ResultType &value_p
-) noexcept {
-    return result(value_p, status::warning(DefaultDomain, 0));
+    U &&value_p
+) noexcept(std::is_nothrow_constructible_v<ResultType, U&&>) {
+    return result(ResultType(std::forward<U>(value_p)), status::warning(DefaultDomain, 0));
 }
 
 
 template<typename ResultType>
-template<typename Enum>
-    requires std::is_enum_v<Enum>
+template<typename Enum, typename U>
+    requires (std::is_enum_v<Enum> and std::is_constructible_v<ResultType, U&&>)
 constexpr result<ResultType> result<ResultType>::warning(
     domain_id domain,
     Enum code,
-    const ResultType &value_p
-) noexcept {
-    return result(value_p, status::warning(domain, code));
+    U &&value_p
+) noexcept(std::is_nothrow_constructible_v<ResultType, U&&>) {
+    return result(ResultType(std::forward<U>(value_p)), status::warning(domain, code));
 }
 
 
 template<typename ResultType>
-constexpr result<ResultType> result<ResultType>::error(
-    const ResultType &value_p
-) noexcept {
-    return result(value_p, status::error(DefaultDomain, 0));
+constexpr result<ResultType> result<ResultType>::error() noexcept {
+    return result(failure(status::error(DefaultDomain, 0)));
 }
 
 
@@ -149,10 +503,129 @@ template<typename Enum>
     requires std::is_enum_v<Enum>
 constexpr result<ResultType> result<ResultType>::error(
     domain_id domain,
-    Enum code,
-    const ResultType &value_p
+    Enum code
 ) noexcept {
-    return result(value_p, status::error(domain, code));
+    return result(failure(status::error(domain, code)));
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+template<typename ResultType>
+template<typename... Args>
+constexpr void result<ResultType>::construct(Args&&... args) {
+    std::construct_at(std::addressof(_value), std::forward<Args>(args)...);
+}
+
+
+template<typename ResultType>
+constexpr void result<ResultType>::destroy() noexcept {
+    std::destroy_at(std::addressof(_value));
+}
+
+/* ========================================================== result<void> ======================================================== */
+
+constexpr result<void>::operator bool() const noexcept {
+    return bool(_status);
+}
+
+
+constexpr bool result<void>::operator==(const status &status_p) const noexcept {
+    return this->_status == status_p;
+}
+
+
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+constexpr bool result<void>::operator==(const Enum &status_p) const noexcept {
+    return this->_status == status_p;
+}
+
+
+constexpr bool result<void>::has_value() const noexcept {
+    return _status.category() != status_code::Category::Error;
+}
+
+
+constexpr void result<void>::value() const noexcept {
+    assert(has_value());
+}
+
+
+template<typename Function>
+    requires details::is_result_v<std::invoke_result_t<Function>>
+constexpr auto result<void>::and_then(Function &&function) const {
+
+    using Result = std::remove_cvref_t<std::invoke_result_t<Function>>;
+
+    if(has_value())
+        return std::invoke(std::forward<Function>(function));
+
+    return Result(failure(_status));
+}
+
+
+template<typename Function>
+    requires std::is_invocable_v<Function>
+constexpr auto result<void>::map(Function &&function) const {
+
+    using Value = std::remove_cvref_t<std::invoke_result_t<Function>>;
+
+    if constexpr(std::is_void_v<Value>) {
+        if(has_value())
+            std::invoke(std::forward<Function>(function));
+        return result<void>(_status);
+    } else {
+        if(has_value())
+            return result<Value>(std::invoke(std::forward<Function>(function)), _status);
+        return result<Value>(failure(_status));
+    }
+}
+
+
+template<typename Function>
+    requires std::is_same_v<std::remove_cvref_t<std::invoke_result_t<Function, const status&>>, result<void>>
+constexpr result<void> result<void>::or_else(Function &&function) const {
+
+    if(has_value())
+        return *this;
+
+    return std::invoke(std::forward<Function>(function), _status);
+}
+
+
+constexpr result<void> result<void>::success() noexcept {
+    return result(status::success(DefaultDomain, 0));
+}
+
+
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+constexpr result<void> result<void>::success(domain_id domain, Enum code) noexcept {
+    return result(status::success(domain, code));
+}
+
+
+constexpr result<void> result<void>::warning() noexcept {
+    return result(status::warning(DefaultDomain, 0));
+}
+
+
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+constexpr result<void> result<void>::warning(domain_id domain, Enum code) noexcept {
+    return result(status::warning(domain, code));
+}
+
+
+constexpr result<void> result<void>::error() noexcept {
+    return result(status::error(DefaultDomain, 0));
+}
+
+
+template<typename Enum>
+    requires std::is_enum_v<Enum>
+constexpr result<void> result<void>::error(domain_id domain, Enum code) noexcept {
+    return result(status::error(domain, code));
 }
 
 /* ================================================================================================================================ */
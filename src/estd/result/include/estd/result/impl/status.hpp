@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Tuesday, 13th July 2021 7:57:43 am
- * @modified   Sunday, 26th June 2022 11:56:59 am
+ * @modified   Monday, 19th October 2026 8:58:21 pm
  * @project    cpp-utils
  * @brief      Implementation of inline fucntions and function tempaltes related to the status class
  * 
@@ -25,12 +25,16 @@ namespace estd {
 /* ====================================================== Public constructors ===================================================== */
 
 constexpr status::status(status_code code) noexcept :
-    current_code(code), current_domain(DefaultDomain)
+    status(DefaultDomain, code)
 {}
 
 
 constexpr status::status(domain_id domain, status_code code) noexcept :
-    current_code(code), current_domain(domain)
+    representation(
+        (uint64_t((domain != nullptr) ? domain->getIndex() : NullDomainIndex) << domain_offset) |
+        (uint64_t(code.code())                                                << code_offset)   |
+         uint64_t(code.category())
+    )
 {}
 
 
@@ -51,19 +55,19 @@ constexpr status &status::operator=(const Enum &rstatus) noexcept {
 
 
 constexpr status::operator bool() const noexcept {
-    return bool(current_code);
+    return category() == status_code::Category::Success;
 }
     
     
 template<typename Enum>
     requires std::is_enum_v<Enum>
 constexpr status::operator Enum() const noexcept {
-    return Enum(current_code);
+    return Enum(status_code(*this));
 }
 
 
 constexpr status::operator status_code() const noexcept {
-    return current_code;
+    return status_code(category(), code());
 }
 
 
@@ -83,36 +87,36 @@ constexpr bool status::operator!=(const Enum &rstatus) const noexcept {
 /* ======================================================== Public methods ======================================================== */
 
 constexpr domain_id status::domain() const noexcept {
-    return current_domain;
+    return find_domain(domain_index(representation >> domain_offset));
 }
 
 
 constexpr status_code::Category status::category() const noexcept {
-    return current_code.category();
+    return status_code::Category(representation & category_mask);
 }
 
 
 constexpr uint32_t status::code() const noexcept {
-    return current_code.code();
+    return uint32_t((representation >> code_offset) & code_mask);
 }
 
 
 template<typename Enum>
         requires std::is_enum_v<Enum>
 constexpr Enum status::code_enum() const noexcept {
-    return current_code.code_enum<Enum>();
+    return status_code(*this).code_enum<Enum>();
 }
 
 
-constexpr std::string_view status::to_string() noexcept {
-    return (
-        // Check whether table contains description of the code
-        get_domain_descriptor(current_domain).getTable(current_code.category()).size() >= current_code.code()
-    ) ?
-        // If so, return it
-        get_domain_descriptor(current_domain).getTable(current_code.category())[current_code.code()] : 
-        // Else, return empty string
-        std::string_view{};
+constexpr std::string_view status::to_string() const noexcept {
+
+    domain_id descriptor = domain();
+
+    // Statuses of unregistered domains have no description
+    if(descriptor == nullptr)
+        return std::string_view{};
+
+    return status_code(*this).to_string(get_domain_descriptor(descriptor).getTable(category()));
 }
 
 /* ===================================================== Public static methods ==================================================== */
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Monday, 12th July 2021 8:25:41 am
- * @modified   Sunday, 26th June 2022 11:56:59 am
+ * @modified   Monday, 19th October 2026 5:02:13 pm
  * @project    cpp-utils
  * @brief      Implementation of status_code class 'es methods
  * 
@@ -106,7 +106,7 @@ constexpr Enum status_code::code_enum() const noexcept {
 constexpr std::string_view status_code::to_string(const std::span<const char*> &context) const noexcept {
     return (
         // Check whether current code is represented in the array
-        context.size() >= representation.semantical.code
+        context.size() > representation.semantical.code
     ) ?
         // If so, return description
         context[representation.semantical.code] :
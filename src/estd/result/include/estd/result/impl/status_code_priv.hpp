@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Monday, 12th July 2021 8:49:12 am
- * @modified   Sunday, 26th June 2022 11:56:59 am
+ * @modified   Monday, 19th October 2026 4:08:39 pm
  * @project    cpp-utils
  * @brief      
  * 
@@ -39,10 +39,6 @@ constexpr status_code::Representation::Representation(uint32_t status) noexcept
 {}
 
 
-constexpr status_code::Representation::Representation(const union Representation &rrep) noexcept :
-    numerical(rrep.numerical)
-{}
-
 /* ==================================================== Inner types' operators ==================================================== */
 
 constexpr bool status_code::Representation::operator==(const Representation &rrep) const noexcept {
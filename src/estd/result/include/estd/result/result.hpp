@@ -3,12 +3,12 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Tuesday, 13th July 2021 9:47:10 am
- * @modified   Tuesday, 28th February 2023 8:59:15 pm
+ * @modified   Monday, 19th October 2026 6:41:27 pm
  * @project    cpp-utils
  * @brief      Header file of the result class template representing an rabitrary pair {value, status}. status indicates
  *             status of the operation that returned result as well as whether value conains a valid value.
- * 
- * 
+ *
+ *
  * @copyright Krzysztof Pierczyk © 2022
  */// ============================================================================================================================= */
 
@@ -17,6 +17,9 @@
 
 /* =========================================================== Includes =========================================================== */
 
+#include <concepts>
+#include <type_traits>
+#include <utility>
 #include "estd/result/status.hpp"
 
 /* =========================================================== Namespace ========================================================== */
@@ -25,85 +28,255 @@ namespace estd {
 
 /* ========================================================= Declarations ========================================================= */
 
+template<typename ResultType>
+class result;
+
+namespace details {
+
+    /// Checks whether @p T is a specialization of the result class template
+    template<typename T>
+    struct is_result : std::false_type { };
+
+    template<typename T>
+    struct is_result<result<T>> : std::true_type { };
+
+    /// Checks whether @p T (without cv-ref qualifiers) is a specialization of the result class template
+    template<typename T>
+    inline constexpr bool is_result_v = is_result<std::remove_cvref_t<T>>::value;
+
+}
+
+/**
+ * @class failure
+ * @brief Error status propagated from the result holding no value (e.g. by ESTD_TRY). Unlike the plain
+ *    status it converts into result of any type (also the one that is not default-constructible), as it
+ *    never requires the value to be constructed
+ */
+class failure {
+
+public: /* ------------------------------------------------- Public constructors -------------------------------------------------- */
+
+    /**
+     * @brief Wraps the @p status which is expected to be an error. Other statuses (which would require the
+     *    value) are replaced with Error::Unknown status of the default domain
+     * @param status
+     *    error status to be propagated
+     */
+    inline constexpr explicit failure(const status &status) noexcept;
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    /**
+     * @brief Converts failure back to the plain status
+     * @returns
+     *    propagated status
+     */
+    inline constexpr operator const status &() const noexcept;
+
+public: /* --------------------------------------------------- Public variables --------------------------------------------------- */
+
+    // Propagated status (always an error)
+    status _status;
+
+};
+
 /**
  * @class result
- * @brief Representation of the generic action's result holding additional informations about 
+ * @brief Representation of the generic action's result holding additional informations about
  *    it's status code
- * @tparam ResultType 
+ * @details The value is held only if the status is not of the @c Error category (i.e. for @c Success
+ *    and @c Warning statuses), so erroneous results do not construct the value at all. Results of
+ *    trivially copyable types are trivially copyable themselves.
+ *
+ *    Results can be chained with monadic combinators or with the ESTD_TRY macros:
+ *
+ *    @code
+ *
+ *    estd::result<config> load() {
+ *        ESTD_TRY_ASSIGN(auto text, read_file(path));
+ *        return parse(text).map([](auto &&raw) { return config{ raw }; });
+ *    }
+ *
+ *    @endcode
+ *
+ * @tparam ResultType
  *    category of the value associated with result
  */
 template<typename ResultType>
 class result  {
 
+    static_assert(not std::is_reference_v<ResultType>, "[estd::result] Result cannot hold references");
+
+    /// Assignment of results can be performed by copying their bytes
+    static constexpr bool trivially_copy_assignable =
+        std::is_trivially_copy_assignable_v<ResultType>    and
+        std::is_trivially_copy_constructible_v<ResultType> and
+        std::is_trivially_destructible_v<ResultType>;
+
+    /// Move-assignment of results can be performed by copying their bytes
+    static constexpr bool trivially_move_assignable =
+        std::is_trivially_move_assignable_v<ResultType>    and
+        std::is_trivially_move_constructible_v<ResultType> and
+        std::is_trivially_destructible_v<ResultType>;
+
+public: /* ---------------------------------------------------- Public types ------------------------------------------------------ */
+
+    /// Type of the value
+    using value_type = ResultType;
+
 public: /* ------------------------------------------------- Public constructors -------------------------------------------------- */
 
     /**
-     * @brief Constructs a result object with the given given @p status and value initialized to
-     *    ResultType()
-     * @param status 
+     * @brief Constructs a result object with the given given @p status. If the status is not an error,
+     *    value is initialized to ResultType()
+     * @note Results of types that are not default-constructible can be created from the @ref failure
+     * @param status
      *    status code associated with result
      */
-    inline constexpr result(const status &status = status::success()) noexcept;
+    inline constexpr result(const status &status = status::success())
+        noexcept(std::is_nothrow_default_constructible_v<ResultType>)
+        requires std::is_default_constructible_v<ResultType>;
+
+    /**
+     * @brief Constructs a result object holding no value with the given error status
+     * @param failure
+     *    error status associated with result
+     */
+    inline constexpr result(const failure &failure) noexcept;
 
     /**
      * @brief Constructs a new result object
-     * @param value 
-     *    value associated with the result
-     * @param status 
+     * @param value
+     *    value associated with the result (ignored if @p status is an error)
+     * @param status
      *    status associated with the result
      */
-    inline constexpr result(const ResultType &value, const status &status = status::success()) noexcept;   
+    inline constexpr result(const ResultType &value, const status &status = status::success())
+        noexcept(std::is_nothrow_copy_constructible_v<ResultType>);
+
+    /**
+     * @brief Constructs a new result object moving the @p value
+     * @param value
+     *    value associated with the result (ignored if @p status is an error)
+     * @param status
+     *    status associated with the result
+     */
+    inline constexpr result(ResultType &&value, const status &status = status::success())
+        noexcept(std::is_nothrow_move_constructible_v<ResultType>);
+
+    /**
+     * @brief Constructs a successful result constructing the value in place from @p args
+     * @param args
+     *    arguments of the value's constructor
+     */
+    template<typename... Args>
+        requires std::is_constructible_v<ResultType, Args&&...>
+    inline constexpr explicit result(std::in_place_t, Args&&... args)
+        noexcept(std::is_nothrow_constructible_v<ResultType, Args&&...>);
 
     /**
      * @brief Constructs a result copying data from @p rresult
-     * @param rresult 
+     * @param rresult
      *    result to be copied to the created status code
      */
-    inline constexpr result(const result &rresult) noexcept = default;
+    inline constexpr result(const result &rresult)
+        requires std::is_trivially_copy_constructible_v<ResultType> = default;
+    inline constexpr result(const result &rresult)
+        noexcept(std::is_nothrow_copy_constructible_v<ResultType>)
+        requires (not std::is_trivially_copy_constructible_v<ResultType>);
+
+    /**
+     * @brief Constructs a result moving data from @p rresult
+     * @param rresult
+     *    result to be moved to the created status code
+     */
+    inline constexpr result(result &&rresult)
+        requires std::is_trivially_move_constructible_v<ResultType> = default;
+    inline constexpr result(result &&rresult)
+        noexcept(std::is_nothrow_move_constructible_v<ResultType>)
+        requires (not std::is_trivially_move_constructible_v<ResultType>);
+
+    /**
+     * @brief Destroys the value (if held)
+     */
+    inline constexpr ~result() requires std::is_trivially_destructible_v<ResultType> = default;
+    inline constexpr ~result() requires (not std::is_trivially_destructible_v<ResultType>);
 
 public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
 
     /**
      * @brief Assigns one result code to another
-     * @param rresult 
+     * @param rresult
      *    result to be assigned
-     * @returns 
+     * @returns
+     *    reference to assignment's left value
+     */
+    inline constexpr result &operator=(const result &rresult)
+        requires trivially_copy_assignable = default;
+    inline constexpr result &operator=(const result &rresult)
+        noexcept(std::is_nothrow_copy_constructible_v<ResultType> and std::is_nothrow_copy_assignable_v<ResultType>)
+        requires (not trivially_copy_assignable);
+
+    /**
+     * @brief Moves one result code to another
+     * @param rresult
+     *    result to be moved
+     * @returns
      *    reference to assignment's left value
      */
-    inline constexpr result &operator=(const result &rresult) noexcept = default;
+    inline constexpr result &operator=(result &&rresult)
+        requires trivially_move_assignable = default;
+    inline constexpr result &operator=(result &&rresult)
+        noexcept(std::is_nothrow_move_constructible_v<ResultType> and std::is_nothrow_move_assignable_v<ResultType>)
+        requires (not trivially_move_assignable);
 
     /**
-     * @brief Assigns value to a result code
-     * @param value 
+     * @brief Assigns value to a result code. If the result holds an error, its status is changed to
+     *    the success
+     * @param value
      *    value to be assigned
-     * @returns 
+     * @returns
      *    reference to assignment's left value
      */
-    inline constexpr result &operator=(const ResultType &value) noexcept;
+    inline constexpr result &operator=(const ResultType &value);
 
     /**
-     * @brief Assigns status code to a result code
-     * @param status 
+     * @brief Moves value to a result code. If the result holds an error, its status is changed to
+     *    the success
+     * @param value
+     *    value to be assigned
+     * @returns
+     *    reference to assignment's left value
+     */
+    inline constexpr result &operator=(ResultType &&value);
+
+    /**
+     * @brief Assigns status code to a result code. The value is destroyed if the @p status is an error
+     *    and default-constructed if the result did not hold it
+     * @param status
      *    status code to be assigned
-     * @returns 
+     * @returns
      *    reference to assignment's left value
      */
-    inline constexpr result &operator=(const status &status) noexcept;
+    inline constexpr result &operator=(const status &status)
+        noexcept(std::is_nothrow_default_constructible_v<ResultType>)
+        requires std::is_default_constructible_v<ResultType>;
 
     /**
      * @brief Assigns enum-derived status code to the result object
-     * @param status 
+     * @param status
      *    status to be assigned
-     * @returns 
+     * @returns
      *    reference to assignment's left value
      */
     template<typename Enum>
-        requires std::is_enum_v<Enum>    
-    inline constexpr result &operator=(const Enum &status) noexcept;
+        requires (std::is_enum_v<Enum> and std::is_default_constructible_v<ResultType>)
+    inline constexpr result &operator=(const Enum &status)
+        noexcept(std::is_nothrow_default_constructible_v<ResultType>);
 
     /**
      * @brief Converts result o the boolean category
-     * @returns 
+     * @returns
      *    @c true when status associated with result is @c Success \n
      *    @c false otherwise
      */
@@ -111,29 +284,31 @@ public: /* --------------------------------------------------- Public operators
 
     /**
      * @brief Comparison operator
-     * @param rresult 
+     * @param rresult
      *    result to be compared with @p this
-     * @returns 
+     * @returns
      *    @c true when results have the same value and status code \n
      *    @c false otherwise
      */
-    inline constexpr bool operator==(const result &rresult) const noexcept = default;
+    inline constexpr bool operator==(const result &rresult) const noexcept
+        requires std::equality_comparable<ResultType>;
 
     /**
      * @brief Comparison operator of result's value
-     * @param rvalue 
+     * @param rvalue
      *    value to be compared with result's value
-     * @returns 
-     *    @c true when result's value is equal to @p value \n
+     * @returns
+     *    @c true when result holds value equal to @p value \n
      *    @c false otherwise
      */
-    inline constexpr bool operator==(const ResultType &rvalue) const noexcept;
+    inline constexpr bool operator==(const ResultType &rvalue) const noexcept
+        requires std::equality_comparable<ResultType>;
 
     /**
      * @brief Comparison operator between result code and and status code derived from enumeration
-     * @param status 
+     * @param status
      *    status to be compared with local status
-     * @returns 
+     * @returns
      *    @c true when result's status is equal to @p status \n
      *    @c false otherwise
      */
@@ -141,58 +316,103 @@ public: /* --------------------------------------------------- Public operators
 
     /**
      * @brief Comparison operator between result code and and status code derived from enumeration
-     * @param status 
+     * @param status
      *    status enum code to be compared with @p this
-     * @returns 
+     * @returns
      *    @c true when status codes have the same category and code \n
      *    @c false otherwise
      */
     template<typename Enum>
-        requires std::is_enum_v<Enum>    
+        requires std::is_enum_v<Enum>
     inline constexpr bool operator==(const Enum &status) const noexcept;
 
+    /// @returns reference to the held value
+    inline constexpr ResultType &operator*() & noexcept;
+    /// @returns reference to the held value
+    inline constexpr const ResultType &operator*() const & noexcept;
+    /// @returns rvalue reference to the held value
+    inline constexpr ResultType &&operator*() && noexcept;
+
+    /// @returns pointer to the held value
+    inline constexpr ResultType *operator->() noexcept;
+    /// @returns pointer to the held value
+    inline constexpr const ResultType *operator->() const noexcept;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
     /**
-     * @brief Comparison operator
-     * @param rresult 
-     *    result to be compared with @p this
-     * @returns 
-     *    @c false when results have the same value and status code \n
-     *    @c true otherwise
+     * @returns
+     *    @c true if the result holds the value (i.e. its status is not an error) \n
+     *    @c false otherwise
      */
-    inline constexpr bool operator!=(const result &rresult) const noexcept = default;
+    inline constexpr bool has_value() const noexcept;
 
     /**
-     * @brief Comparison operator of result's value
-     * @param rresult 
-     *    result to be compared with @p this
-     * @returns 
-     *    @c false when result's value is equal to @p value \n
-     *    @c true otherwise
+     * @returns
+     *    reference to the held value
+     * @note Result must hold the value
      */
-    inline constexpr bool operator!=(const ResultType &value) const noexcept;
+    inline constexpr ResultType &value() & noexcept;
+    inline constexpr const ResultType &value() const & noexcept;
+    inline constexpr ResultType &&value() && noexcept;
 
     /**
-     * @brief Comparison operator between result code and and status code derived from enumeration
-     * @param status 
-     *    status to be compared with local status
-     * @returns 
-     *    @c false when result's status is equal to @p status \n
-     *    @c true otherwise
+     * @returns
+     *    the held value or @p default_value if the result holds an error
      */
-    inline constexpr bool operator!=(const status &status) const noexcept;
+    template<typename U>
+        requires std::is_convertible_v<U&&, ResultType>
+    inline constexpr ResultType value_or(U &&default_value) const &;
+    template<typename U>
+        requires std::is_convertible_v<U&&, ResultType>
+    inline constexpr ResultType value_or(U &&default_value) &&;
 
     /**
-     * @brief Comparison operator between result code and and status code derived from enumeration
-     * @param status 
-     *    status enum code to be compared with @p this
-     * @returns 
-     *    @c false when status codes have the same category and code \n
-     *    @c true otherwise
+     * @brief Calls @p function returning a result with the held value.
+     * @returns
+     *    result of the @p function if the result holds the value \n
+     *    error of the result converted to the type returned by the @p function otherwise
+     * @note Warning status of the result is not propagated
      */
-    template<typename Enum>
-        requires std::is_enum_v<Enum>    
-    inline constexpr bool operator!=(const Enum &status) const noexcept;
-    
+    template<typename Function>
+        requires details::is_result_v<std::invoke_result_t<Function, ResultType&>>
+    inline constexpr auto and_then(Function &&function) &;
+    template<typename Function>
+        requires details::is_result_v<std::invoke_result_t<Function, const ResultType&>>
+    inline constexpr auto and_then(Function &&function) const &;
+    template<typename Function>
+        requires details::is_result_v<std::invoke_result_t<Function, ResultType&&>>
+    inline constexpr auto and_then(Function &&function) &&;
+
+    /**
+     * @brief Transforms the held value with the @p function
+     * @returns
+     *    result holding value returned by the @p function with the status of this result \n
+     *    error of the result otherwise
+     */
+    template<typename Function>
+        requires std::is_invocable_v<Function, ResultType&>
+    inline constexpr auto map(Function &&function) &;
+    template<typename Function>
+        requires std::is_invocable_v<Function, const ResultType&>
+    inline constexpr auto map(Function &&function) const &;
+    template<typename Function>
+        requires std::is_invocable_v<Function, ResultType&&>
+    inline constexpr auto map(Function &&function) &&;
+
+    /**
+     * @brief Calls @p function with the status of the result holding an error
+     * @returns
+     *    copy of the result if it holds the value \n
+     *    result of the @p function (being the result of the same type) otherwise
+     */
+    template<typename Function>
+        requires std::is_same_v<std::remove_cvref_t<std::invoke_result_t<Function, const status&>>, result>
+    inline constexpr result or_else(Function &&function) const &;
+    template<typename Function>
+        requires std::is_same_v<std::remove_cvref_t<std::invoke_result_t<Function, const status&>>, result>
+    inline constexpr result or_else(Function &&function) &&;
+
 public: /* ------------------------------------------------ Static public methods ------------------------------------------------- */
 
     /**
@@ -200,109 +420,312 @@ public: /* ------------------------------------------------ Static public method
      *    and value initialized to @p value
      * @param value
      *    result's value
-     * @returns 
+     * @returns
      *    result of the @c Success category
      */
-    static inline constexpr result success(const ResultType &value = ResultType()) noexcept;
+    template<typename U = ResultType>
+        requires std::is_constructible_v<ResultType, U&&>
+    static inline constexpr result success(U &&value = U()) noexcept(std::is_nothrow_constructible_v<ResultType, U&&>);
 
     /**
      * @brief Creates result with status code of @c Success category assigned to @p domain with @p code code
      *    (casted to the numeric category) and value initialized to @p value
      * @param domain
      *    domain of the status
-     * @param code 
+     * @param code
      *    code to be set in the produces status code
      * @param value
      *    result's value
-     * @returns 
+     * @returns
      *    result of the @c Success category
      */
-    template<typename Enum>
-        requires std::is_enum_v<Enum>    
+    template<typename Enum, typename U = ResultType>
+        requires (std::is_enum_v<Enum> and std::is_constructible_v<ResultType, U&&>)
     static inline constexpr result success(
         domain_id domain,
         Enum code,
-        const ResultType &value = ResultType()
-    ) noexcept;
+        U &&value = U()
+    ) noexcept(std::is_nothrow_constructible_v<ResultType, U&&>);
 
     /**
      * @brief Creates result with status code of @c Warning category assigned to @c DefaultDomain with @p 0 code
      *    and value initialized to @p value
      * @param value
      *    result's value
-     * @returns 
+     * @returns
      *    result of the @c Warning category
      */
-    static inline constexpr result warning(const ResultType &value = ResultType()) noexcept;
+    template<typename U = ResultType>
+        requires std::is_constructible_v<ResultType, U&&>
+    static inline constexpr result warning(U &&value = U()) noexcept(std::is_nothrow_constructible_v<ResultType, U&&>);
 
     /**
      * @brief Creates result with status code of @c Warning category assigned to @p domain with @p code code
      *    (casted to the numeric category) and value initialized to @p value
      * @param domain
      *    domain of the status
-     * @param code 
+     * @param code
      *    code to be set in the produces status code
      * @param value
      *    result's value
-     * @returns 
+     * @returns
      *    result of the @c Warning category
      */
-    template<typename Enum>
-        requires std::is_enum_v<Enum>    
+    template<typename Enum, typename U = ResultType>
+        requires (std::is_enum_v<Enum> and std::is_constructible_v<ResultType, U&&>)
     static inline constexpr result warning(
         domain_id domain,
         Enum code,
-        const ResultType &value = ResultType()
-    ) noexcept;
+        U &&value = U()
+    ) noexcept(std::is_nothrow_constructible_v<ResultType, U&&>);
 
     /**
      * @brief Creates result with status code of @c Error category assigned to @c DefaultDomain with @p 0 code
-     *    and value initialized to @p value
-     * @param value
-     *    result's value
-     * @returns 
-     *    result of the @c Error category
+     * @returns
+     *    result of the @c Error category (holding no value)
      */
-    static inline constexpr result error(const ResultType &value = ResultType()) noexcept;
+    static inline constexpr result error() noexcept;
 
     /**
      * @brief Creates result with status code of @c Error category assigned to @p domain with @p code code
-     *    (casted to the numeric category) and value initialized to @p value
+     *    (casted to the numeric category)
      * @param domain
      *    domain of the status
-     * @param code 
+     * @param code
      *    code to be set in the produces status code
-     * @param value
-     *    result's value
-     * @returns 
-     *    result of the @c Error category
+     * @returns
+     *    result of the @c Error category (holding no value)
      */
     template<typename Enum>
-        requires std::is_enum_v<Enum>    
-    static inline constexpr result error(
-        domain_id domain,
-        Enum code,
-        const ResultType &value = ResultType()
-    ) noexcept;
+        requires std::is_enum_v<Enum>
+    static inline constexpr result error(domain_id domain, Enum code) noexcept;
+
+public: /* --------------------------------------------------- Public variables --------------------------------------------------- */
+
+    // status associated with the result
+    status _status;
+
+    union {
+
+        // Value associated with the result (alive only if @ref _status is not an error)
+        ResultType _value;
+
+    };
+
+private: /* -------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    /// Constructs the value from @p args
+    template<typename... Args>
+    inline constexpr void construct(Args&&... args);
+
+    /// Destroys the value
+    inline constexpr void destroy() noexcept;
+
+};
+
+/**
+ * @class result<void>
+ * @brief Specialization of the result for actions that produce no value (status only)
+ */
+template<>
+class result<void>  {
+
+public: /* ---------------------------------------------------- Public types ------------------------------------------------------ */
+
+    /// Type of the value
+    using value_type = void;
+
+public: /* ------------------------------------------------- Public constructors -------------------------------------------------- */
+
+    /**
+     * @brief Constructs a result object with the given given @p status
+     * @param status
+     *    status code associated with result
+     */
+    constexpr result(const status &status = status::success()) noexcept : _status{ status } { }
+
+    /**
+     * @brief Constructs a result object with the given error status
+     * @param failure
+     *    error status associated with result
+     */
+    constexpr result(const failure &failure) noexcept : _status{ failure._status } { }
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    /**
+     * @brief Converts result o the boolean category
+     * @returns
+     *    @c true when status associated with result is @c Success \n
+     *    @c false otherwise
+     */
+    inline constexpr explicit operator bool() const noexcept;
+
+    /**
+     * @brief Comparison operator
+     * @param rresult
+     *    result to be compared with @p this
+     * @returns
+     *    @c true when results have the same status code \n
+     *    @c false otherwise
+     */
+    inline constexpr bool operator==(const result &rresult) const noexcept = default;
+
+    /**
+     * @brief Comparison operator between result and status
+     * @param status
+     *    status to be compared with local status
+     * @returns
+     *    @c true when result's status is equal to @p status \n
+     *    @c false otherwise
+     */
+    inline constexpr bool operator==(const status &status) const noexcept;
+
+    /**
+     * @brief Comparison operator between result and status code derived from enumeration
+     * @param status
+     *    status enum code to be compared with @p this
+     * @returns
+     *    @c true when status codes have the same category and code \n
+     *    @c false otherwise
+     */
+    template<typename Enum>
+        requires std::is_enum_v<Enum>
+    inline constexpr bool operator==(const Enum &status) const noexcept;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    @c true if the status is not an error \n
+     *    @c false otherwise
+     */
+    inline constexpr bool has_value() const noexcept;
+
+    /**
+     * @brief Checks that the result is not an error (for symmetry with the non-void result)
+     */
+    inline constexpr void value() const noexcept;
+
+    /**
+     * @brief Calls @p function returning a result if this result is not an error
+     * @returns
+     *    result of the @p function if the result is not an error \n
+     *    error of the result converted to the type returned by the @p function otherwise
+     */
+    template<typename Function>
+        requires details::is_result_v<std::invoke_result_t<Function>>
+    inline constexpr auto and_then(Function &&function) const;
+
+    /**
+     * @brief Calls @p function producing the value if this result is not an error
+     * @returns
+     *    result holding value returned by the @p function with the status of this result \n
+     *    error of the result otherwise
+     */
+    template<typename Function>
+        requires std::is_invocable_v<Function>
+    inline constexpr auto map(Function &&function) const;
+
+    /**
+     * @brief Calls @p function with the status of the result holding an error
+     * @returns
+     *    copy of the result if it is not an error \n
+     *    result of the @p function otherwise
+     */
+    template<typename Function>
+        requires std::is_same_v<std::remove_cvref_t<std::invoke_result_t<Function, const status&>>, result>
+    inline constexpr result or_else(Function &&function) const;
+
+public: /* ------------------------------------------------ Static public methods ------------------------------------------------- */
+
+    /// @returns result with status code of @c Success category assigned to @c DefaultDomain with @p 0 code
+    static inline constexpr result success() noexcept;
+
+    /// @returns result with status code of @c Success category assigned to @p domain with @p code code
+    template<typename Enum>
+        requires std::is_enum_v<Enum>
+    static inline constexpr result success(domain_id domain, Enum code) noexcept;
+
+    /// @returns result with status code of @c Warning category assigned to @c DefaultDomain with @p 0 code
+    static inline constexpr result warning() noexcept;
+
+    /// @returns result with status code of @c Warning category assigned to @p domain with @p code code
+    template<typename Enum>
+        requires std::is_enum_v<Enum>
+    static inline constexpr result warning(domain_id domain, Enum code) noexcept;
+
+    /// @returns result with status code of @c Error category assigned to @c DefaultDomain with @p 0 code
+    static inline constexpr result error() noexcept;
+
+    /// @returns result with status code of @c Error category assigned to @p domain with @p code code
+    template<typename Enum>
+        requires std::is_enum_v<Enum>
+    static inline constexpr result error(domain_id domain, Enum code) noexcept;
 
 public: /* --------------------------------------------------- Public variables --------------------------------------------------- */
 
     // status associated with the result
     status _status;
 
-    // Value associated with the result
-    ResultType _value;
-     
 };
 
 /* ================================================================================================================================ */
 
 } // End namespace estd
 
+/* ============================================================ Macros ============================================================ */
+
+/// Auxiliary macro concatenating tokens after their expansion
+#define ESTD_RESULT_CONCAT_IMPL(a, b) a##b
+#define ESTD_RESULT_CONCAT(a, b) ESTD_RESULT_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Evaluates @p expr yielding the result and returns its status from the calling function if
+ *    it holds an error. The calling function has to return a type constructible from estd::failure
+ *    (i.e. any estd::result or estd::status)
+ *
+ *    @code
+ *
+ *    estd::result<void> save(const config &cfg) {
+ *        ESTD_TRY(open_file(path));
+ *        ...
+ *    }
+ *
+ *    @endcode
+ */
+#define ESTD_TRY(expr)                                                        \
+    do {                                                                      \
+        if(auto &&estd_try_result_ = (expr); not estd_try_result_.has_value()) \
+            return estd::failure{ estd_try_result_._status };                 \
+    } while(0)
+
+/**
+ * @brief Evaluates @p expr yielding the result and either returns its status from the calling function
+ *    (if it holds an error) or initializes/assigns @p lhs with the held value
+ *
+ *    @code
+ *
+ *    estd::result<int> parse_port(std::string_view text) {
+ *        ESTD_TRY_ASSIGN(auto number, parse_int(text));
+ *        return number + 1;
+ *    }
+ *
+ *    @endcode
+ */
+#define ESTD_TRY_ASSIGN(lhs, expr) \
+    ESTD_TRY_ASSIGN_IMPL(ESTD_RESULT_CONCAT(estd_try_result_, __COUNTER__), lhs, expr)
+
+#define ESTD_TRY_ASSIGN_IMPL(result, lhs, expr) \
+    auto &&result = (expr);                     \
+    if(not result.has_value())                  \
+        return estd::failure{ result._status }; \
+    lhs = std::move(result).value()
+
 /* ==================================================== Implementation Includes =================================================== */
 
 #include "estd/result/impl/result.hpp"
 
 /* ================================================================================================================================ */
 
-#endif
\ No newline at end of file
+#endif
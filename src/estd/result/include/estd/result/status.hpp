@@ -3,14 +3,16 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Monday, 12th July 2021 9:59:51 am
- * @modified   Wednesday, 19th October 2022 9:57:37 pm
+ * @modified   Monday, 19th October 2026 8:58:21 pm
  * @project    cpp-utils
  * @brief      Header file of the class representing generic status of the operation composed of the status_code and domain pointer.
  *             Additional component (compared to the status_code) provides unique distinction between results produced by various 
  *             domains of the project.
  * 
  *             As a unique domain identifier a pointer to the statically allocated array of strings is used. This way it is possible
- *             to simply assign human-readable representations of the status to the objects.
+ *             to simply assign human-readable representations of the status to the objects. To keep the status in a single register,
+ *             it stores only the small index of the domain packed along with the category and the code into one 64-bit word. The
+ *             pointer is looked up in the domains' registry when needed.
  *    
  * @copyright Krzysztof Pierczyk © 2021
  */// ============================================================================================================================= */
@@ -20,7 +22,8 @@
 
 /* =========================================================== Includes =========================================================== */
 
-#include "estd/result/default_domain.hpp"
+#include <cstdint>
+#include "estd/result/domain_registry.hpp"
 
 /* =========================================================== Namespace ========================================================== */
 
@@ -42,7 +45,7 @@ public: /* ------------------------------------------------- Public constructors
     /**
      * @brief Construct a new status described by the @p code in the given @p domain
      * @param domain
-     *     domain of the status
+     *     domain of the status (may be @c nullptr)
      * @param code
      *     code describing the status
      */
@@ -165,8 +168,12 @@ public: /* --------------------------------------------------- Public operators
 public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
 
     /**
+     * @warning Only the index of the domain is stored, so the domain is known only after it has been registered
+     *    with @ref register_domain(). Until then checks like `s.domain() == MyDomain` fail even for statuses
+     *    created with @c MyDomain
      * @returns 
-     *    @category category of the status
+     *    domain of the status \n
+     *    @c nullptr if the domain has not been registered (or the status was created with the @c nullptr domain)
      */
     inline constexpr domain_id domain() const noexcept;
 
@@ -195,7 +202,7 @@ public: /* ---------------------------------------------------- Public methods -
      * @returns 
      *    string representation of the status code
      */
-    inline constexpr std::string_view to_string() noexcept;
+    inline constexpr std::string_view to_string() const noexcept;
 
 public: /* ------------------------------------------------ Static public methods ------------------------------------------------- */
 
@@ -343,13 +350,21 @@ public: /* ------------------------------------------------ Static public method
         requires std::is_enum_v<Enum>    
     static inline constexpr status error(domain_id domain, Enum code) noexcept;
 
+private: /* -------------------------------------------------- Private constants -------------------------------------------------- */
+
+    // Offset of the code in the packed representation (category occupies the lowest bits)
+    static constexpr unsigned code_offset = 2;
+    // Offset of the domain's index in the packed representation
+    static constexpr unsigned domain_offset = 32;
+    // Mask of the category in the packed representation
+    static constexpr uint64_t category_mask = (uint64_t(1) << code_offset) - 1;
+    // Mask of the code (after shifting it to the LSB)
+    static constexpr uint64_t code_mask = (uint64_t(1) << (domain_offset - code_offset)) - 1;
+
 private: /* -------------------------------------------------- Private variales --------------------------------------------------- */
 
-    // Code of the status
-    status_code current_code;
-    
-    // Domain of the status
-    domain_id current_domain;
+    // Category (bits 0-1), code (bits 2-31) and domain's index (bits 32-47) of the status
+    uint64_t representation;
     
 };
 
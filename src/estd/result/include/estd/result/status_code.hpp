@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Monday, 14th June 2021 7:39:49 pm
- * @modified   Tuesday, 28th February 2023 8:57:38 pm
+ * @modified   Monday, 19th October 2026 4:08:39 pm
  * @project    cpp-utils
  * @brief      Header of the status_code class representing a generic status code
  * 
@@ -329,11 +329,11 @@ private: /* ---------------------------------------------------- Private types -
         inline constexpr Representation(uint32_t status) noexcept;
 
         /**
-         * @brief Construct a new numerical representation of the status
-         * @param status 
-         *    numerical value
+         * @brief Copies the representation (trivially, so that status codes are trivially copyable)
+         * @param rrep 
+         *    representation to be copied
          */        
-        inline constexpr Representation(const union Representation &rrep) noexcept;
+        inline constexpr Representation(const union Representation &rrep) noexcept = default;
 
     public:
 
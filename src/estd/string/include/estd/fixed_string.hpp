@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Monday, 12th July 2021 9:25:13 am
- * @modified   Tuesday, 28th February 2023 8:18:12 pm
+ * @modified   Sunday, 18th October 2026 11:21:25 pm
  * @project    cpp-utils
  * @brief      Header file of compile-time strings literal
  *    
@@ -906,6 +906,7 @@ using fixed_wstring = basic_fixed_string<wchar_t, Size>;
 
 #include "estd/fixed_string/impl/fixed_string.hpp"
 #include "estd/fixed_string/fixed_string_functions.hpp"
+#include "estd/fixed_string/fixed_string_parsing.hpp"
 
 /* ================================================================================================================================ */
 
@@ -0,0 +1,131 @@
+/* ============================================================================================================================ *//**
+ * @file       fixed_string_parsing.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:21:25 pm
+ * @modified   Monday, 19th October 2026 9:41:09 pm
+ * @project    cpp-utils
+ * @brief      Compile-time tokenization and numbers parsing of the compile-time strings literal
+ * @details Algorithms defined in this file take the parsed string as a non-type template parameter. This way the number of
+ *    tokens produced by split<...>() is a compile-time constant and results of all algorithms can be stored in constexpr
+ *    tables (so that no parsing is performed at runtime). Views returned by split<...>() refer to the template parameter
+ *    object of the string which has a static storage duration.
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_FIXED_STRING_PARSING_H__
+#define __ESTD_FIXED_STRING_PARSING_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <array>
+#include <concepts>
+#include <optional>
+#include "estd/fixed_string.hpp"
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace estd {
+
+/* ======================================================= String algorithms ====================================================== */
+
+/**
+ * @brief Removes leading and trailing whitespaces from the @p str
+ * @tparam str
+ *    string to be trimmed
+ * @returns
+ *    fixed string of the reduced size holding trimmed @p str
+ */
+template <basic_fixed_string str>
+[[nodiscard]] constexpr auto trim() noexcept;
+
+/**
+ * @brief Splits @p str into tokens separated with @p delim character
+ * @note Empty tokens (e.g. between two consecutive delimiters) are preserved
+ *
+ * @tparam str
+ *    string to be split
+ * @tparam delim
+ *    delimiter character
+ * @returns
+ *    std::array of string views (referring to the @p str ) holding subsequent tokens
+ */
+template <basic_fixed_string str, typename decltype(str)::value_type delim>
+[[nodiscard]] constexpr auto split() noexcept;
+
+/* ======================================================= Numbers parsing ======================================================== */
+
+/**
+ * @brief Parses (trimmed) @p str as an integral number of type @p T
+ * @details Supports optional sign (for signed types) and '0x'/'0b'/'0o' base prefixes.
+ *    Invalid format and out-of-range values result in compilation error
+ *
+ * @tparam T
+ *    target type
+ * @tparam str
+ *    string to be parsed
+ * @returns
+ *    parsed value
+ */
+template <std::integral T, basic_fixed_string str>
+[[nodiscard]] constexpr T to_integer() noexcept;
+
+/**
+ * @brief Parses (trimmed) @p str as a floating-point number of type @p T
+ * @details Supports decimal notation with optional sign, fractional part and exponent. The value is correctly
+ *    rounded (to nearest, ties to even) - the same as given by the literal. Invalid format results in compilation error
+ *
+ * @tparam T
+ *    target type
+ * @tparam str
+ *    string to be parsed
+ * @returns
+ *    parsed value
+ */
+template <std::floating_point T, basic_fixed_string str>
+[[nodiscard]] constexpr T to_floating() noexcept;
+
+/**
+ * @brief Splits @p str into tokens separated with @p delim and parses (trimmed) tokens as integral
+ *    numbers of type @p T
+ *
+ * @tparam T
+ *    target type
+ * @tparam str
+ *    string to be parsed
+ * @tparam delim
+ *    delimiter character
+ * @returns
+ *    std::array of parsed values
+ */
+template <std::integral T, basic_fixed_string str, typename decltype(str)::value_type delim>
+[[nodiscard]] constexpr auto split_to_integer() noexcept;
+
+/**
+ * @brief Splits @p str into tokens separated with @p delim and parses (trimmed) tokens as floating-point
+ *    numbers of type @p T
+ *
+ * @tparam T
+ *    target type
+ * @tparam str
+ *    string to be parsed
+ * @tparam delim
+ *    delimiter character
+ * @returns
+ *    std::array of parsed values
+ */
+template <std::floating_point T, basic_fixed_string str, typename decltype(str)::value_type delim>
+[[nodiscard]] constexpr auto split_to_floating() noexcept;
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/fixed_string/impl/fixed_string_parsing.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,656 @@
+/* ============================================================================================================================ *//**
+ * @file       fixed_string_parsing.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:21:25 pm
+ * @modified   Monday, 19th October 2026 9:41:09 pm
+ * @project    cpp-utils
+ * @brief      Implementation of compile-time tokenization and numbers parsing of the compile-time strings literal
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_FIXED_STRING_PARSING_IMPL_H__
+#define __ESTD_FIXED_STRING_PARSING_IMPL_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include "estd/fixed_string/fixed_string_parsing.hpp"
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace estd {
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace details {
+
+    /**
+     * @brief Checks whether @p c is a whitespace character
+     */
+    template <typename CharType>
+    constexpr bool is_space(CharType c) noexcept {
+        return
+            (c == CharType(' '))  or
+            (c == CharType('\t')) or
+            (c == CharType('\n')) or
+            (c == CharType('\r')) or
+            (c == CharType('\f')) or
+            (c == CharType('\v'));
+    }
+
+    /**
+     * @brief Converts @p c to the numerical value of the digit ( @c -1 if @p c is not an alphanumeric digit)
+     */
+    template <typename CharType>
+    constexpr int digit_value(CharType c) noexcept {
+        if(c >= CharType('0') and c <= CharType('9'))
+            return int(c - CharType('0'));
+        if(c >= CharType('a') and c <= CharType('z'))
+            return int(c - CharType('a')) + 10;
+        if(c >= CharType('A') and c <= CharType('Z'))
+            return int(c - CharType('A')) + 10;
+        return -1;
+    }
+
+    /**
+     * @brief Removes leading and trailing whitespaces from the @p sv
+     */
+    template <typename CharType, typename TraitsType>
+    constexpr std::basic_string_view<CharType, TraitsType> trim(std::basic_string_view<CharType, TraitsType> sv) noexcept {
+        while(not sv.empty() and is_space(sv.front()))
+            sv.remove_prefix(1);
+        while(not sv.empty() and is_space(sv.back()))
+            sv.remove_suffix(1);
+        return sv;
+    }
+
+    /**
+     * @brief Counts tokens of @p sv separated with @p delim
+     */
+    template <typename CharType, typename TraitsType>
+    constexpr std::size_t count_tokens(std::basic_string_view<CharType, TraitsType> sv, CharType delim) noexcept {
+        std::size_t count = 1;
+        for(auto c : sv)
+            count += (c == delim) ? 1 : 0;
+        return count;
+    }
+
+    /**
+     * @brief Splits @p sv into @p N tokens separated with @p delim
+     */
+    template <std::size_t N, typename CharType, typename TraitsType>
+    constexpr auto split(std::basic_string_view<CharType, TraitsType> sv, CharType delim) noexcept {
+
+        std::array<std::basic_string_view<CharType, TraitsType>, N> tokens;
+
+        for(std::size_t i = 0; i < N; ++i) {
+
+            // Find end of the current token (not with find(), which GCC cannot evaluate with sanitizers enabled)
+            std::size_t end = 0;
+            while(end < sv.size() and sv[end] != delim)
+                ++end;
+            // Store the token
+            tokens[i] = sv.substr(0, end);
+            // Skip the token and the delimiter
+            sv.remove_prefix((end == sv.size()) ? end : end + 1);
+        }
+
+        return tokens;
+    }
+
+    /**
+     * @brief Parses @p sv as integral value of type @p T
+     * @returns
+     *    parsed value on success
+     *    @c std::nullopt on invalid format or if value does not fit in @p T
+     */
+    template <std::integral T, typename CharType, typename TraitsType>
+    constexpr std::optional<T> parse_integer(std::basic_string_view<CharType, TraitsType> sv) noexcept {
+
+        sv = trim(sv);
+
+        // Parse the sign
+        bool negative = false;
+        if(not sv.empty() and (sv.front() == CharType('+') or sv.front() == CharType('-'))) {
+            negative = (sv.front() == CharType('-'));
+            sv.remove_prefix(1);
+        }
+
+        // Parse the base prefix
+        unsigned base = 10;
+        if(sv.size() > 2 and sv[0] == CharType('0')) {
+            switch(sv[1]) {
+                case CharType('x'): case CharType('X'): base = 16; break;
+                case CharType('o'): case CharType('O'): base =  8; break;
+                case CharType('b'): case CharType('B'): base =  2; break;
+                default: break;
+            }
+            if(base != 10)
+                sv.remove_prefix(2);
+        }
+
+        // Empty strings are not valid numbers
+        if(sv.empty())
+            return std::nullopt;
+
+        // Compute maximal magnitude of the value
+        std::uintmax_t limit = std::uintmax_t(std::numeric_limits<T>::max());
+        if(negative)
+            limit = std::is_signed_v<T> ? limit + 1 : 0;
+
+        // Accumulate digits
+        std::uintmax_t value = 0;
+        for(auto c : sv) {
+
+            int digit = digit_value(c);
+
+            // Check if digit is valid
+            if(digit < 0 or unsigned(digit) >= base)
+                return std::nullopt;
+            // Check for overflow
+            if(unsigned(digit) > limit or value > (limit - unsigned(digit)) / base)
+                return std::nullopt;
+
+            value = value * base + unsigned(digit);
+        }
+
+        // Wrap-around conversion of the unsigned magnitude yields a valid negative value for signed types
+        return negative ? T(std::uintmax_t(0) - value) : T(value);
+    }
+
+    /**
+     * @brief Minimal unsigned big integer used by the exact decimal-to-binary conversion
+     * @tparam Limbs
+     *    capacity of the integer in 32-bit limbs (operations assume that it is never exceeded)
+     */
+    template <std::size_t Limbs>
+    struct big_unsigned {
+
+        /// Limbs of the integer (least significant first)
+        std::array<std::uint32_t, Limbs> limbs{};
+        /// Number of used limbs (the most significant used limb is non-zero)
+        std::size_t size = 0;
+
+        /// Computes this * factor + addend
+        constexpr void multiply_add(std::uint32_t factor, std::uint32_t addend) noexcept {
+
+            std::uint64_t carry = addend;
+
+            for(std::size_t i = 0; i < size; ++i) {
+                carry    += std::uint64_t(limbs[i]) * factor;
+                limbs[i]  = std::uint32_t(carry);
+                carry   >>= 32;
+            }
+
+            if(carry != 0) {
+                assert(size < Limbs);
+                limbs[size++] = std::uint32_t(carry);
+            }
+        }
+
+        /// Multiplies the integer by 10^( @p exponent )
+        constexpr void multiply_pow10(std::size_t exponent) noexcept {
+
+            for(; exponent >= 9; exponent -= 9)
+                multiply_add(1'000'000'000U, 0);
+
+            std::uint32_t factor = 1;
+            for(; exponent > 0; --exponent)
+                factor *= 10;
+
+            multiply_add(factor, 0);
+        }
+
+        /// Multiplies the integer by 2^( @p bits )
+        constexpr void shift_left(std::size_t bits) noexcept {
+
+            if(size == 0)
+                return;
+
+            std::size_t limbs_shift = bits / 32;
+            std::size_t bits_shift  = bits % 32;
+
+            assert(size + limbs_shift + 1 <= Limbs);
+
+            limbs[size + limbs_shift] = 0;
+            for(std::size_t i = size; i > 0; --i) {
+                std::uint64_t word = std::uint64_t(limbs[i - 1]) << bits_shift;
+                limbs[i + limbs_shift]     |= std::uint32_t(word >> 32);
+                limbs[i + limbs_shift - 1]  = std::uint32_t(word);
+            }
+            for(std::size_t i = 0; i < limbs_shift; ++i)
+                limbs[i] = 0;
+
+            size += limbs_shift + 1;
+            normalize();
+        }
+
+        /// Divides the integer by 2
+        constexpr void shift_right_one() noexcept {
+
+            for(std::size_t i = 0; i < size; ++i)
+                limbs[i] = (limbs[i] >> 1) | ((i + 1 < size) ? (limbs[i + 1] << 31) : 0U);
+
+            normalize();
+        }
+
+        /// Subtracts @p other (not greater than this)
+        constexpr void subtract(const big_unsigned &other) noexcept {
+
+            std::int64_t borrow = 0;
+
+            for(std::size_t i = 0; i < size; ++i) {
+                std::int64_t difference = std::int64_t(limbs[i]) - ((i < other.size) ? other.limbs[i] : 0U) - borrow;
+                borrow   = (difference < 0) ? 1 : 0;
+                limbs[i] = std::uint32_t(difference + (borrow << 32));
+            }
+
+            normalize();
+        }
+
+        /// Sets the @p bit of the integer
+        constexpr void set_bit(std::size_t bit) noexcept {
+
+            for(; size <= bit / 32; ++size)
+                limbs[size] = 0;
+
+            limbs[bit / 32] |= std::uint32_t(1) << (bit % 32);
+        }
+
+        /// Returns number of significant bits of the integer
+        constexpr std::size_t bit_length() const noexcept {
+            return (size == 0) ? 0 : (size - 1) * 32 + std::bit_width(limbs[size - 1]);
+        }
+
+        /// Three-way comparison of integers
+        constexpr std::strong_ordering operator<=>(const big_unsigned &other) const noexcept {
+
+            if(size != other.size)
+                return size <=> other.size;
+
+            for(std::size_t i = size; i > 0; --i) {
+                if(limbs[i - 1] != other.limbs[i - 1])
+                    return limbs[i - 1] <=> other.limbs[i - 1];
+            }
+
+            return std::strong_ordering::equal;
+        }
+
+        /// Drops leading zero limbs
+        constexpr void normalize() noexcept {
+            while(size > 0 and limbs[size - 1] == 0)
+                --size;
+        }
+
+    };
+
+    /**
+     * @brief Bounds of the exact conversion of decimal numbers into values of type @p T
+     */
+    template <std::floating_point T>
+    struct floating_parse_bounds {
+
+        static_assert(std::numeric_limits<T>::radix == 2, "Only binary floating-point types are supported");
+
+        /// Number of bits of the significand
+        static constexpr long precision = std::numeric_limits<T>::digits;
+        /// Binary exponent of the least significant bit of subnormal values
+        static constexpr long min_exponent = std::numeric_limits<T>::min_exponent - precision;
+        /// Binary exponent of the least significant bit of the maximal value
+        static constexpr long max_exponent = std::numeric_limits<T>::max_exponent - precision;
+
+        /**
+         * @brief Number of significant decimal digits taken into account. Points halfway between adjacent
+         *    values - the only ones deciding about rounding - have no more digits, so remaining digits
+         *    can be reduced to the single 'sticky' digit
+         */
+        static constexpr std::size_t max_digits = std::size_t(std::max(
+            ((precision + 1) * 30103 + (1 - min_exponent) * 69897) / 100000,
+            ((precision + 1 + max_exponent) * 30103) / 100000
+        )) + 2;
+
+        /// Decimal exponent such that 10^( - @a min_decimal ) is below half of the minimal subnormal value
+        static constexpr long min_decimal = ((1 - min_exponent) * 30103) / 100000 + 1;
+        /// Decimal exponent such that 10^( @a max_decimal ) is above the maximal value rounded up
+        static constexpr long max_decimal = (std::numeric_limits<T>::max_exponent * 30103) / 100000 + 1;
+
+        /// Capacity (in 32-bit limbs) of integers used by the conversion (log2(10) < 3.322)
+        static constexpr std::size_t limbs = std::size_t(std::max({
+            long(((max_digits + 1) * 3322) / 1000) + 1 - min_exponent,
+            long(((max_digits + 2 + min_decimal) * 3322) / 1000) + precision + 2,
+            long(((max_decimal + 2) * 3322) / 1000) + precision + 2
+        }) + 64) / 32 + 1;
+
+        /// Category of integers used by the conversion
+        using integer = big_unsigned<limbs>;
+    };
+
+    /**
+     * @brief Constructs value of type @p T equal to @p significand * 2^( @p exponent ) (the value is assumed to be
+     *    representable)
+     */
+    template <std::floating_point T, std::size_t Limbs>
+    constexpr T make_floating(const big_unsigned<Limbs> &significand, long exponent) noexcept {
+
+        T value = 0;
+
+        // Every partial sum holds the leading bits of the significand, so it is exact
+        for(std::size_t i = significand.size; i > 0; --i)
+            value = value * T(std::uint64_t(1) << 32) + T(significand.limbs[i - 1]);
+
+        // Scaling by powers of 2 is exact as long as the result is representable
+        for(; exponent > 0; exponent -= std::min(exponent, 60L))
+            value *= T(std::uint64_t(1) << std::min(exponent, 60L));
+        for(; exponent < 0; exponent += std::min(-exponent, 60L))
+            value /= T(std::uint64_t(1) << std::min(-exponent, 60L));
+
+        return value;
+    }
+
+    /**
+     * @brief Parses @p sv as floating-point value of type @p T
+     * @details The value is correctly rounded (to nearest, ties to even), i.e. it is equal to the one given
+     *    by the literal or by std::strtod(). Decimal digits are converted exactly with big integers
+     * @returns
+     *    parsed value on success
+     *    @c std::nullopt on invalid format or if value does not fit in @p T
+     */
+    template <std::floating_point T, typename CharType, typename TraitsType>
+    constexpr std::optional<T> parse_floating(std::basic_string_view<CharType, TraitsType> sv) noexcept {
+
+        using bounds  = floating_parse_bounds<T>;
+        using integer = typename bounds::integer;
+
+        sv = trim(sv);
+
+        // Parse the sign
+        bool negative = false;
+        if(not sv.empty() and (sv.front() == CharType('+') or sv.front() == CharType('-'))) {
+            negative = (sv.front() == CharType('-'));
+            sv.remove_prefix(1);
+        }
+
+        // Significant decimal digits of the value (digits above the limit are reflected in the exponent)
+        integer numerator;
+        // Number of significant digits stored in the numerator
+        std::size_t significant = 0;
+        // Set if any of dropped digits is non-zero
+        bool sticky = false;
+        // Decimal exponent of the value
+        long exponent = 0;
+        // Number of parsed digits
+        std::size_t digits = 0;
+
+        // Digits are accumulated in chunks of 9 to limit the number of operations on the big integer
+        std::uint32_t chunk        = 0;
+        std::uint32_t chunk_factor = 1;
+
+        // Helper accumulating digits of the mantissa
+        auto parse_digits = [&](bool fractional) {
+            while(not sv.empty() and digit_value(sv.front()) >= 0 and digit_value(sv.front()) < 10) {
+
+                unsigned digit = unsigned(digit_value(sv.front()));
+
+                // Leading zeros are not significant
+                if(digit == 0 and significant == 0) {
+                    exponent -= fractional ? 1 : 0;
+                } else if(significant < bounds::max_digits) {
+
+                    chunk         = chunk * 10 + digit;
+                    chunk_factor *= 10;
+                    significant  += 1;
+                    exponent     -= fractional ? 1 : 0;
+
+                    if(chunk_factor == 1'000'000'000U) {
+                        numerator.multiply_add(chunk_factor, chunk);
+                        chunk        = 0;
+                        chunk_factor = 1;
+                    }
+
+                } else {
+                    sticky    = sticky or (digit != 0);
+                    exponent += fractional ? 0 : 1;
+                }
+
+                ++digits;
+                sv.remove_prefix(1);
+            }
+        };
+
+        // Parse integral part
+        parse_digits(false);
+        // Parse fractional part
+        if(not sv.empty() and sv.front() == CharType('.')) {
+            sv.remove_prefix(1);
+            parse_digits(true);
+        }
+
+        // At least one digit is required
+        if(digits == 0)
+            return std::nullopt;
+
+        // Parse the exponent
+        if(not sv.empty() and (sv.front() == CharType('e') or sv.front() == CharType('E'))) {
+
+            sv.remove_prefix(1);
+
+            // Parse exponent's sign
+            bool negative_exponent = false;
+            if(not sv.empty() and (sv.front() == CharType('+') or sv.front() == CharType('-'))) {
+                negative_exponent = (sv.front() == CharType('-'));
+                sv.remove_prefix(1);
+            }
+
+            // Parse exponent's value (saturate on values larger than any representable exponent)
+            if(sv.empty())
+                return std::nullopt;
+            long explicit_exponent = 0;
+            while(not sv.empty() and digit_value(sv.front()) >= 0 and digit_value(sv.front()) < 10) {
+                explicit_exponent = std::min(explicit_exponent * 10 + digit_value(sv.front()), 100'000L);
+                sv.remove_prefix(1);
+            }
+
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+        }
+
+        // Trailing characters are not allowed
+        if(not sv.empty())
+            return std::nullopt;
+
+        // Zero mantissa yields zero regardless of the exponent
+        if(significant == 0)
+            return negative ? -T(0) : T(0);
+
+        numerator.multiply_add(chunk_factor, chunk);
+
+        // Dropped digits are replaced with a single non-zero digit placing the value between the same halfway points
+        if(sticky) {
+            numerator.multiply_add(10, 1);
+            significant += 1;
+            exponent    -= 1;
+        }
+
+        // Value is below 10^(significant + exponent), so it rounds to zero
+        if(long(significant) + exponent <= -bounds::min_decimal)
+            return negative ? -T(0) : T(0);
+        // Value is not below 10^(significant - 1 + exponent), so it rounds to the infinity
+        if(long(significant) - 1 + exponent >= bounds::max_decimal)
+            return std::nullopt;
+
+        // Express the value as the ratio of integers
+        integer denominator;
+        denominator.multiply_add(1, 1);
+        if(exponent >= 0)
+            numerator.multiply_pow10(std::size_t(exponent));
+        else
+            denominator.multiply_pow10(std::size_t(-exponent));
+
+        // Find the binary exponent of the most significant bit of the value
+        long magnitude = long(numerator.bit_length()) - long(denominator.bit_length());
+        {
+            integer scaled_numerator   = numerator;
+            integer scaled_denominator = denominator;
+
+            if(magnitude >= 0)
+                scaled_denominator.shift_left(std::size_t(magnitude));
+            else
+                scaled_numerator.shift_left(std::size_t(-magnitude));
+
+            if(scaled_numerator < scaled_denominator)
+                magnitude -= 1;
+        }
+
+        // Binary exponent of the least significant bit of the result
+        long binary_exponent = std::max(magnitude - (bounds::precision - 1), bounds::min_exponent);
+        if(binary_exponent >= 0)
+            denominator.shift_left(std::size_t(binary_exponent));
+        else
+            numerator.shift_left(std::size_t(-binary_exponent));
+
+        // Divide bit by bit (the quotient has at most 'precision' bits)
+        integer significand;
+        integer divisor = denominator;
+        divisor.shift_left(std::size_t(bounds::precision));
+        for(long bit = bounds::precision; bit >= 0; --bit) {
+            if(numerator >= divisor) {
+                numerator.subtract(divisor);
+                significand.set_bit(std::size_t(bit));
+            }
+            divisor.shift_right_one();
+        }
+
+        // Round to nearest, ties to even
+        numerator.shift_left(1);
+        auto half = numerator <=> denominator;
+        if(half > 0 or (half == 0 and significand.size > 0 and (significand.limbs[0] & 1) != 0))
+            significand.multiply_add(1, 1);
+
+        // Rounding may carry into the next binary order of magnitude
+        if(significand.bit_length() > std::size_t(bounds::precision)) {
+            significand.shift_right_one();
+            binary_exponent += 1;
+        }
+
+        // Reject values that round to the infinity
+        if(binary_exponent > bounds::max_exponent)
+            return std::nullopt;
+
+        T value = make_floating<T>(significand, binary_exponent);
+
+        return negative ? -value : value;
+    }
+
+    /**
+     * @brief Parses all @p tokens with @p parse function
+     * @returns
+     *    array of parsed values on success
+     *    @c std::nullopt if any token could not be parsed
+     */
+    template <typename T, std::size_t N, typename StringView, typename Parser>
+    constexpr std::optional<std::array<T, N>> parse_tokens(const std::array<StringView, N> &tokens, Parser parse) noexcept {
+
+        std::array<T, N> values{};
+
+        for(std::size_t i = 0; i < N; ++i) {
+            auto value = parse(tokens[i]);
+            if(not value.has_value())
+                return std::nullopt;
+            values[i] = *value;
+        }
+
+        return values;
+    }
+
+}
+
+/* ======================================================= String algorithms ====================================================== */
+
+template <basic_fixed_string str>
+constexpr auto trim() noexcept {
+
+    using string_type = std::remove_cvref_t<decltype(str)>;
+    using string_view_type = typename string_type::string_view_type;
+
+    // Find trimmed view of the string
+    constexpr string_view_type trimmed = details::trim(static_cast<string_view_type>(str));
+
+    // Copy view into the fixed string of the target size
+    basic_fixed_string<typename string_type::value_type, trimmed.size(), typename string_type::traits_type> result;
+    details::copy(trimmed.begin(), trimmed.end(), result.begin());
+
+    return result;
+}
+
+
+template <basic_fixed_string str, typename decltype(str)::value_type delim>
+constexpr auto split() noexcept {
+
+    using string_view_type = typename std::remove_cvref_t<decltype(str)>::string_view_type;
+
+    constexpr string_view_type sv = static_cast<string_view_type>(str);
+
+    return details::split<details::count_tokens(sv, delim)>(sv, delim);
+}
+
+/* ======================================================= Numbers parsing ======================================================== */
+
+template <std::integral T, basic_fixed_string str>
+constexpr T to_integer() noexcept {
+
+    using string_view_type = typename std::remove_cvref_t<decltype(str)>::string_view_type;
+
+    constexpr auto value = details::parse_integer<T>(static_cast<string_view_type>(str));
+    static_assert(value.has_value(), "String does not represent a valid integral value of the target type");
+
+    return *value;
+}
+
+
+template <std::floating_point T, basic_fixed_string str>
+constexpr T to_floating() noexcept {
+
+    using string_view_type = typename std::remove_cvref_t<decltype(str)>::string_view_type;
+
+    constexpr auto value = details::parse_floating<T>(static_cast<string_view_type>(str));
+    static_assert(value.has_value(), "String does not represent a valid floating-point value of the target type");
+
+    return *value;
+}
+
+
+template <std::integral T, basic_fixed_string str, typename decltype(str)::value_type delim>
+constexpr auto split_to_integer() noexcept {
+
+    constexpr auto values = details::parse_tokens<T>(split<str, delim>(), [](auto token) {
+        return details::parse_integer<T>(token);
+    });
+    static_assert(values.has_value(), "String does not represent a valid list of integral values of the target type");
+
+    return *values;
+}
+
+
+template <std::floating_point T, basic_fixed_string str, typename decltype(str)::value_type delim>
+constexpr auto split_to_floating() noexcept {
+
+    constexpr auto values = details::parse_tokens<T>(split<str, delim>(), [](auto token) {
+        return details::parse_floating<T>(token);
+    });
+    static_assert(values.has_value(), "String does not represent a valid list of floating-point values of the target type");
+
+    return *values;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+#endif
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Friday, 22nd April 2022 1:09:36 am
- * @modified   Sunday, 26th June 2022 3:41:37 pm
+ * @modified   Monday, 19th October 2026 9:12:37 pm
  * @project    cpp-utils
  * @brief      Definitions of helper synchronisation primitives
  * 
@@ -19,11 +19,19 @@
 // Standard includes
 #include <mutex>
 #include <atomic>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 
 /* ========================================================== Namespaces ========================================================== */
 
 namespace estd {
 
+/* ========================================================== Constants =========================================================== */
+
+/// Size of the cache line assumed when laying out synchronisation primitives
+inline constexpr std::size_t cache_line_size = 64;
+
 /* ========================================================== Empty lock ========================================================== */
 
 /**
@@ -39,10 +47,75 @@ struct empty_lock {
 
 };
 
+/* ============================================================ Backoff =========================================================== */
+
+/**
+ * @brief Hints the CPU that the calling thread is busy-waiting (PAUSE on x86, YIELD on ARM). Reduces power
+ *    consumption of the spin and frees pipeline resources for the sibling hyper-thread
+ */
+inline void cpu_relax() noexcept;
+
+/**
+ * @brief Behaviour of the busy-waiting thread once the backoff has reached its limit
+ */
+enum class spin_wait {
+
+    /// Keep spinning with the maximal backoff
+    spin,
+    /// Yield the processor to other threads (std::this_thread::yield())
+    yield,
+
+};
+
+/**
+ * @brief Bounded exponential backoff used by busy-waiting loops. Each step executes cpu_relax() the number
+ *    of times that doubles with every step up to @ref max_spins
+ */
+class spin_backoff {
+
+public: /* -------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Number of relax instructions executed in the first step
+    static constexpr std::uint32_t min_spins = 1;
+
+    /// Maximal number of relax instructions executed in a single step
+    static constexpr std::uint32_t max_spins = 64;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Constructs the backoff
+     * @param wait
+     *    behaviour once the backoff has reached its limit
+     */
+    constexpr spin_backoff(spin_wait wait = spin_wait::yield) noexcept : wait{ wait } { }
+
+    /**
+     * @brief Performs single step of the backoff
+     */
+    inline void operator()() noexcept;
+
+    /**
+     * @brief Resets the backoff to the initial step
+     */
+    void reset() noexcept { spins = min_spins; }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Behaviour once the backoff has reached its limit
+    spin_wait wait;
+
+    /// Number of relax instructions executed in the next step
+    std::uint32_t spins { min_spins };
+
+};
+
 /* =========================================================== Spinlock =========================================================== */
 
 /**
- * @brief Auxiliary class implementing atomic-based spinlock
+ * @brief Auxiliary class implementing atomic-based test-and-test-and-set spinlock. Waiters spin on the
+ *    relaxed load (keeping the cache line shared instead of bouncing it with RMW operations) with
+ *    bounded exponential backoff and retry the exchange only when the lock is observed free
  */
 class spin_lock {
 
@@ -50,8 +123,10 @@ public: /* ---------------------------------------------------- Public methods -
 
     /**
      * @brief Constructs the spinlock
+     * @param wait
+     *    behaviour of waiters once the backoff has reached its limit
      */
-    inline spin_lock();
+    inline spin_lock(spin_wait wait = spin_wait::yield);
 
     /**
      * @brief Move-constructs the spinlock
@@ -68,6 +143,13 @@ public: /* ---------------------------------------------------- Public methods -
      * @brief Locks the spinlock
      */
     inline void lock();
+
+    /**
+     * @brief Tries to lock the spinlock without waiting
+     * @returns
+     *    @c true if the lock has been acquired
+     */
+    inline bool try_lock();
     
     /**
      * @brief Unlocks the spinlock
@@ -86,9 +168,336 @@ private: /* ---------------------------------------------------- Private data --
 
     /// State of the lock
     std::atomic<State> state;
+
+    /// Behaviour of waiters once the backoff has reached its limit
+    spin_wait wait;
     
 };
 
+/* ========================================================== Ticket lock ========================================================= */
+
+/**
+ * @brief Fair (FIFO) spinlock. Each locking thread draws a ticket and waits until the lock serves it, so
+ *    threads acquire the lock in the order of arrival and no thread can be starved. Both counters share
+ *    a single cache line
+ * @note As waiters are served strictly in order, preemption of the next waiter stalls all other ones
+ *    (spin_wait::yield mitigates it on oversubscribed systems)
+ */
+class alignas(cache_line_size) ticket_lock {
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Constructs the lock
+     * @param wait
+     *    behaviour of waiters once the backoff has reached its limit
+     */
+    constexpr ticket_lock(spin_wait wait = spin_wait::yield) noexcept : wait{ wait } { }
+
+    /// No copy-constructible
+    ticket_lock(const ticket_lock &other) = delete;
+    /// No copy-asignable
+    ticket_lock &operator=(const ticket_lock &other) = delete;
+
+    /**
+     * @brief Locks the lock
+     */
+    inline void lock() noexcept;
+
+    /**
+     * @brief Tries to lock the lock without waiting (succeeds only if there are no waiters)
+     * @returns
+     *    @c true if the lock has been acquired
+     */
+    inline bool try_lock() noexcept;
+
+    /**
+     * @brief Unlocks the lock passing it to the next waiter
+     */
+    inline void unlock() noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Next ticket to be drawn
+    std::atomic<std::uint32_t> next { 0 };
+
+    /// Ticket being served
+    std::atomic<std::uint32_t> serving { 0 };
+
+    /// Behaviour of waiters once the backoff has reached its limit
+    spin_wait wait;
+
+};
+
+/* =========================================================== MCS lock =========================================================== */
+
+/**
+ * @brief Queue node of the waiter of the mcs_lock
+ */
+struct alignas(cache_line_size) mcs_lock_node {
+
+    /// Next waiter in the queue
+    std::atomic<mcs_lock_node*> next { nullptr };
+
+    /// Flag set as long as the owner of the node has to wait
+    std::atomic<bool> locked { false };
+
+};
+
+/**
+ * @brief Mellor-Crummey and Scott queue lock. Waiters form the FIFO queue of nodes and each of them spins
+ *    on the flag in its own node (own cache line), so the lock hand-off touches only the successor's
+ *    line - contention does not grow with the number of waiters
+ *
+ * @details Lock can be used in two ways:
+ *    - with caller-provided nodes (lock(node), unlock(node)) that have to stay alive and unused
+ *      until the lock is released
+ *    - with the standard lock()/unlock() interface (e.g. with std::lock_guard or synchronised_reference)
+ *      in which case nodes are taken from the small per-thread pool (see @ref thread_nodes)
+ */
+class mcs_lock {
+
+public: /* ---------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the queue node
+    using node = mcs_lock_node;
+
+public: /* -------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Maximal number of mcs_locks held (or waited for) by a single thread using the standard interface
+    static constexpr std::size_t thread_nodes = 16;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Constructs the lock
+     * @param wait
+     *    behaviour of waiters once the backoff has reached its limit
+     */
+    constexpr mcs_lock(spin_wait wait = spin_wait::yield) noexcept : wait{ wait } { }
+
+    /// No copy-constructible
+    mcs_lock(const mcs_lock &other) = delete;
+    /// No copy-asignable
+    mcs_lock &operator=(const mcs_lock &other) = delete;
+
+    /**
+     * @brief Locks the lock enqueuing the caller with the @p waiter node
+     */
+    inline void lock(node &waiter) noexcept;
+
+    /**
+     * @brief Tries to lock the lock with the @p waiter node without waiting
+     * @returns
+     *    @c true if the lock has been acquired
+     */
+    inline bool try_lock(node &waiter) noexcept;
+
+    /**
+     * @brief Unlocks the lock acquired with the @p waiter node passing it to the next waiter
+     */
+    inline void unlock(node &waiter) noexcept;
+
+    /**
+     * @brief Locks the lock using the node from the per-thread pool
+     */
+    inline void lock() noexcept;
+
+    /**
+     * @brief Tries to lock the lock using the node from the per-thread pool without waiting
+     * @returns
+     *    @c true if the lock has been acquired
+     */
+    inline bool try_lock() noexcept;
+
+    /**
+     * @brief Unlocks the lock acquired with lock() or try_lock()
+     */
+    inline void unlock() noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Last waiter in the queue (@c nullptr if the lock is free)
+    alignas(cache_line_size) std::atomic<node*> tail { nullptr };
+
+    /// Node of the current owner (if locked with the standard interface)
+    node *owner { nullptr };
+
+    /// Behaviour of waiters once the backoff has reached its limit
+    spin_wait wait;
+
+};
+
+/* ======================================================= Reader-writer lock ===================================================== */
+
+/**
+ * @brief Reader-writer spinlock with writer preference. Any number of readers may hold the lock at once
+ *    (lock_shared()); the writer holds it exclusively (lock()). Once a writer starts waiting, new readers
+ *    are held back until it has acquired and released the lock, so writers are not starved by the
+ *    continuous stream of readers. Usable with std::lock_guard, std::unique_lock and std::shared_lock
+ */
+class rw_spin_lock {
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Constructs the lock
+     * @param wait
+     *    behaviour of waiters once the backoff has reached its limit
+     */
+    constexpr rw_spin_lock(spin_wait wait = spin_wait::yield) noexcept : wait{ wait } { }
+
+    /// No copy-constructible
+    rw_spin_lock(const rw_spin_lock &other) = delete;
+    /// No copy-asignable
+    rw_spin_lock &operator=(const rw_spin_lock &other) = delete;
+
+    /**
+     * @brief Locks the lock exclusively
+     */
+    inline void lock() noexcept;
+
+    /**
+     * @brief Tries to lock the lock exclusively without waiting
+     * @returns
+     *    @c true if the lock has been acquired
+     */
+    inline bool try_lock() noexcept;
+
+    /**
+     * @brief Unlocks the exclusively locked lock
+     */
+    inline void unlock() noexcept;
+
+    /**
+     * @brief Locks the lock in the shared mode
+     */
+    inline void lock_shared() noexcept;
+
+    /**
+     * @brief Tries to lock the lock in the shared mode without waiting
+     * @returns
+     *    @c true if the lock has been acquired
+     */
+    inline bool try_lock_shared() noexcept;
+
+    /**
+     * @brief Unlocks the lock locked in the shared mode
+     */
+    inline void unlock_shared() noexcept;
+
+    /**
+     * @brief Tries to atomically convert the shared ownership of the calling thread into the exclusive one
+     *    (succeeds only if the calling thread is the only reader)
+     * @returns
+     *    @c true if the lock has been upgraded, @c false if it is still held in the shared mode
+     */
+    inline bool try_unlock_shared_and_lock() noexcept;
+
+private: /* -------------------------------------------------- Private constants --------------------------------------------------- */
+
+    /// Flag set when the writer holds the lock
+    static constexpr std::uint32_t writer = 0x1;
+
+    /// Flag set when the writer waits for the lock
+    static constexpr std::uint32_t writer_waiting = 0x2;
+
+    /// Increment of the state corresponding to a single reader
+    static constexpr std::uint32_t reader = 0x4;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// State of the lock (number of readers and writer's flags)
+    std::atomic<std::uint32_t> state { 0 };
+
+    /// Behaviour of waiters once the backoff has reached its limit
+    spin_wait wait;
+
+};
+
+/* ========================================================= Hybrid mutex ========================================================= */
+
+/**
+ * @brief Mutex spinning for a bounded number of iterations before parking the thread in the kernel
+ *    (std::atomic::wait, i.e. futex on Linux). The spin limit adapts to the time the lock has recently
+ *    been held for - the number of iterations after which the lock was acquired by spinning is averaged
+ *    (and halved whenever spinning runs out of the limit) and the next waiter spins up to twice as long.
+ *    Short critical sections are thus handed over with the latency of the spinlock while waiters of long
+ *    ones quickly stop spinning and go to sleep instead of burning the core.
+ *
+ * @note State is a futex word: 0 - unlocked, 1 - locked, 2 - locked with (possibly) parked waiters, so
+ *    the unlock() enters the kernel only when someone may be sleeping
+ */
+class hybrid_mutex {
+
+public: /* -------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Default upper bound of the number of spin iterations before parking
+    static constexpr std::uint32_t default_max_spins = 100;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Constructs the mutex
+     * @param max_spins
+     *    upper bound of the number of spin iterations before parking (0 disables spinning)
+     */
+    constexpr hybrid_mutex(std::uint32_t max_spins = default_max_spins) noexcept : max_spins{ max_spins } { }
+
+    /// No copy-constructible
+    hybrid_mutex(const hybrid_mutex &other) = delete;
+    /// No copy-asignable
+    hybrid_mutex &operator=(const hybrid_mutex &other) = delete;
+
+    /**
+     * @brief Locks the mutex
+     */
+    inline void lock() noexcept;
+
+    /**
+     * @brief Tries to lock the mutex without waiting
+     * @returns
+     *    @c true if the mutex has been locked
+     */
+    inline bool try_lock() noexcept;
+
+    /**
+     * @brief Unlocks the mutex waking up one of parked waiters (if any)
+     */
+    inline void unlock() noexcept;
+
+private: /* -------------------------------------------------- Private constants --------------------------------------------------- */
+
+    /// State of the unlocked mutex
+    static constexpr std::uint32_t unlocked = 0;
+
+    /// State of the mutex locked with no parked waiters
+    static constexpr std::uint32_t locked = 1;
+
+    /// State of the mutex locked with (possibly) parked waiters
+    static constexpr std::uint32_t contended = 2;
+
+private: /* --------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    /**
+     * @brief Slow path of the lock() - spins adaptively and parks the thread afterwards
+     */
+    inline void lock_contended() noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// State of the mutex (futex word)
+    std::atomic<std::uint32_t> state { unlocked };
+
+    /// Upper bound of the number of spin iterations
+    std::uint32_t max_spins;
+
+    /// Running average of the number of spin iterations after which the lock has been acquired (kept away from
+    /// the futex word, so that updates of waiters do not invalidate the line polled by spinners)
+    alignas(cache_line_size) std::atomic<std::int32_t> spin_estimate { 0 };
+
+};
+
 /* ================================================================================================================================ */
 
 } // End namespace estd
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Wednesday, 18th May 2022 1:24:47 pm
- * @modified   Sunday, 26th June 2022 3:41:37 pm
+ * @modified   Monday, 19th October 2026 9:12:37 pm
  * @project    cpp-utils
  * @brief      Implementations of helper synchronisation primitives
  * 
@@ -16,6 +16,14 @@
 
 /* =========================================================== Includes =========================================================== */
 
+// Standard includes
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <thread>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
 // Private includes
 #include "estd/locks.hpp"
 
@@ -23,20 +31,67 @@
 
 namespace estd {
 
+/* ======================================================= Backoff definitions ==================================================== */
+
+void cpu_relax() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && __ARM_ARCH >= 7)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+
+void spin_backoff::operator()() noexcept {
+
+    // Once the limit has been reached, leave the processor to other threads if requested
+    if(spins == max_spins and wait == spin_wait::yield) {
+        std::this_thread::yield();
+        return;
+    }
+
+    for(std::uint32_t i = 0; i < spins; ++i)
+        cpu_relax();
+
+    if(spins < max_spins)
+        spins *= 2;
+}
+
 /* ===================================================== spin_lock definitions ===================================================== */
 
-spin_lock::spin_lock() : 
-    state(State::Unlocked) 
+spin_lock::spin_lock(spin_wait wait) : 
+    state(State::Unlocked),
+    wait(wait)
 { }
 
 
-spin_lock::spin_lock([[maybe_unused]] spin_lock &&rlock) : 
-    state(State::Unlocked) 
+spin_lock::spin_lock(spin_lock &&rlock) : 
+    state(State::Unlocked),
+    wait(rlock.wait)
 { }
 
 
 void spin_lock::lock() { 
-    while (state.exchange(State::Locked, std::memory_order_acquire) == State::Locked) { }
+
+    // Fast path - uncontended lock
+    if(state.exchange(State::Locked, std::memory_order_acquire) == State::Unlocked)
+        return;
+
+    spin_backoff backoff{ wait };
+
+    // Spin on the (shared) cache line until the lock is observed free and retry
+    do {
+        while(state.load(std::memory_order_relaxed) == State::Locked)
+            backoff();
+    } while(state.exchange(State::Locked, std::memory_order_acquire) == State::Locked);
+}
+
+
+bool spin_lock::try_lock() {
+    return state.load(std::memory_order_relaxed) == State::Unlocked and
+           state.exchange(State::Locked, std::memory_order_acquire) == State::Unlocked;
 }
 
 
@@ -44,6 +99,313 @@ void spin_lock::unlock() {
     state.store(State::Unlocked, std::memory_order_release); 
 }
 
+/* ==================================================== ticket_lock definitions =================================================== */
+
+void ticket_lock::lock() noexcept {
+
+    const std::uint32_t ticket = next.fetch_add(1, std::memory_order_relaxed);
+
+    spin_backoff backoff{ wait };
+
+    while(serving.load(std::memory_order_acquire) != ticket)
+        backoff();
+}
+
+
+bool ticket_lock::try_lock() noexcept {
+
+    std::uint32_t ticket = serving.load(std::memory_order_relaxed);
+
+    // Draw the ticket only if it would be served immediately
+    return next.compare_exchange_strong(ticket, ticket + 1, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+
+void ticket_lock::unlock() noexcept {
+    serving.store(serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/* ===================================================== mcs_lock definitions ===================================================== */
+
+namespace details {
+
+    /**
+     * @brief Pool of mcs_lock nodes of the calling thread used by the standard locking interface
+     */
+    struct mcs_lock_thread_nodes {
+
+        /// Nodes of the pool
+        std::array<mcs_lock_node, mcs_lock::thread_nodes> nodes;
+
+        /// Mask of nodes in use
+        std::uint32_t used { 0 };
+
+        /// Takes free node from the pool
+        mcs_lock_node &acquire() noexcept {
+
+            const auto index = static_cast<std::size_t>(std::countr_one(used));
+
+            // Thread holds (or waits for) more than mcs_lock::thread_nodes locks at once
+            assert(index < nodes.size());
+
+            used |= (std::uint32_t{ 1 } << index);
+
+            return nodes[index];
+        }
+
+        /// Returns @p node to the pool
+        void release(mcs_lock_node &node) noexcept {
+            used &= ~(std::uint32_t{ 1 } << static_cast<std::size_t>(&node - nodes.data()));
+        }
+
+    };
+
+    static_assert(mcs_lock::thread_nodes <= 32, "[estd::mcs_lock] Mask of used nodes is too narrow");
+
+    /// Returns pool of mcs_lock nodes of the calling thread
+    inline mcs_lock_thread_nodes &this_thread_mcs_lock_nodes() noexcept {
+        thread_local mcs_lock_thread_nodes nodes;
+        return nodes;
+    }
+
+}
+
+
+void mcs_lock::lock(node &waiter) noexcept {
+
+    waiter.next.store(nullptr, std::memory_order_relaxed);
+    waiter.locked.store(true, std::memory_order_relaxed);
+
+    // Enqueue the node (release publishes its initialization to the predecessor)
+    node *predecessor = tail.exchange(&waiter, std::memory_order_acq_rel);
+    if(predecessor == nullptr)
+        return;
+
+    predecessor->next.store(&waiter, std::memory_order_release);
+
+    // Spin on the own node until the predecessor hands the lock over
+    spin_backoff backoff{ wait };
+    while(waiter.locked.load(std::memory_order_acquire))
+        backoff();
+}
+
+
+bool mcs_lock::try_lock(node &waiter) noexcept {
+
+    waiter.next.store(nullptr, std::memory_order_relaxed);
+
+    node *expected = nullptr;
+    return tail.compare_exchange_strong(expected, &waiter, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+
+void mcs_lock::unlock(node &waiter) noexcept {
+
+    node *successor = waiter.next.load(std::memory_order_acquire);
+
+    if(successor == nullptr) {
+
+        // No waiter - release the lock
+        node *expected = &waiter;
+        if(tail.compare_exchange_strong(expected, nullptr, std::memory_order_release, std::memory_order_relaxed))
+            return;
+
+        // Waiter has already enqueued itself but has not linked to the node yet
+        spin_backoff backoff{ wait };
+        while((successor = waiter.next.load(std::memory_order_acquire)) == nullptr)
+            backoff();
+    }
+
+    successor->locked.store(false, std::memory_order_release);
+}
+
+
+void mcs_lock::lock() noexcept {
+
+    node &waiter = details::this_thread_mcs_lock_nodes().acquire();
+
+    lock(waiter);
+    owner = &waiter;
+}
+
+
+bool mcs_lock::try_lock() noexcept {
+
+    auto &nodes = details::this_thread_mcs_lock_nodes();
+    node &waiter = nodes.acquire();
+
+    if(not try_lock(waiter)) {
+        nodes.release(waiter);
+        return false;
+    }
+
+    owner = &waiter;
+
+    return true;
+}
+
+
+void mcs_lock::unlock() noexcept {
+
+    // Owner has to be read before the lock is passed to the next thread
+    node &waiter = *owner;
+
+    unlock(waiter);
+    details::this_thread_mcs_lock_nodes().release(waiter);
+}
+
+/* =================================================== rw_spin_lock definitions =================================================== */
+
+void rw_spin_lock::lock() noexcept {
+
+    spin_backoff backoff{ wait };
+
+    for(std::uint32_t current = state.load(std::memory_order_relaxed);;) {
+
+        // No readers nor writer - take the lock (clearing the waiting flag; other waiting writers will set it again)
+        if((current & ~writer_waiting) == 0) {
+            if(state.compare_exchange_weak(current, writer, std::memory_order_acquire, std::memory_order_relaxed))
+                return;
+            continue;
+        }
+
+        // Hold back new readers
+        if((current & writer_waiting) == 0)
+            state.fetch_or(writer_waiting, std::memory_order_relaxed);
+
+        backoff();
+
+        current = state.load(std::memory_order_relaxed);
+    }
+}
+
+
+bool rw_spin_lock::try_lock() noexcept {
+
+    std::uint32_t current = state.load(std::memory_order_relaxed);
+
+    return (current & ~writer_waiting) == 0 and
+        state.compare_exchange_strong(current, writer, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+
+void rw_spin_lock::unlock() noexcept {
+    state.fetch_and(~writer, std::memory_order_release);
+}
+
+
+void rw_spin_lock::lock_shared() noexcept {
+
+    spin_backoff backoff{ wait };
+
+    for(std::uint32_t current = state.load(std::memory_order_relaxed);;) {
+
+        if((current & (writer | writer_waiting)) == 0) {
+            if(state.compare_exchange_weak(current, current + reader, std::memory_order_acquire, std::memory_order_relaxed))
+                return;
+            continue;
+        }
+
+        backoff();
+
+        current = state.load(std::memory_order_relaxed);
+    }
+}
+
+
+bool rw_spin_lock::try_lock_shared() noexcept {
+
+    std::uint32_t current = state.load(std::memory_order_relaxed);
+
+    return (current & (writer | writer_waiting)) == 0 and
+        state.compare_exchange_strong(current, current + reader, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+
+void rw_spin_lock::unlock_shared() noexcept {
+    state.fetch_sub(reader, std::memory_order_release);
+}
+
+
+bool rw_spin_lock::try_unlock_shared_and_lock() noexcept {
+
+    std::uint32_t current = state.load(std::memory_order_relaxed);
+
+    // The only reader becomes the writer (clearing the waiting flag just like lock() does)
+    return (current & ~writer_waiting) == reader and
+        state.compare_exchange_strong(current, writer, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+/* =================================================== hybrid_mutex definitions =================================================== */
+
+void hybrid_mutex::lock() noexcept {
+
+    std::uint32_t expected = unlocked;
+
+    if(not state.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed))
+        lock_contended();
+}
+
+
+bool hybrid_mutex::try_lock() noexcept {
+
+    std::uint32_t expected = unlocked;
+
+    return state.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+
+void hybrid_mutex::unlock() noexcept {
+    if(state.exchange(unlocked, std::memory_order_release) == contended)
+        state.notify_one();
+}
+
+
+void hybrid_mutex::lock_contended() noexcept {
+
+    std::int32_t estimate = spin_estimate.load(std::memory_order_relaxed);
+
+    // Spin up to twice as long as the lock has recently been held for
+    std::uint32_t limit = std::min<std::uint32_t>(max_spins, 2 * static_cast<std::uint32_t>(estimate) + 10);
+    std::uint32_t spins = 0;
+    bool acquired       = false;
+    bool exhausted      = true;
+
+    for(; spins < limit; ++spins) {
+
+        cpu_relax();
+
+        std::uint32_t expected = state.load(std::memory_order_relaxed);
+
+        // Don't spin on the lock with parked waiters - it would be stolen from the one being woken up
+        if(expected == contended) {
+            exhausted = false;
+            break;
+        }
+
+        if(expected == unlocked and
+            state.compare_exchange_weak(expected, locked, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            acquired = true;
+            break;
+        }
+    }
+
+    // Update the estimate (races between waiters are benign - it is only a heuristic)
+    if(acquired) {
+        spin_estimate.store(estimate + (static_cast<std::int32_t>(spins) - estimate) / 8, std::memory_order_relaxed);
+        return;
+    }
+
+    // Lock is held for longer than the limit - spin shorter next time (bail-outs on parked waiters tell nothing)
+    if(exhausted and estimate != 0)
+        spin_estimate.store(estimate / 2, std::memory_order_relaxed);
+
+    // Lock acquired in the 'contended' state as it is unknown whether other threads are parked
+    while(state.exchange(contended, std::memory_order_acquire) != unlocked)
+        state.wait(contended, std::memory_order_relaxed);
+}
+
 /* ================================================================================================================================ */
 
 } // End namespace estd
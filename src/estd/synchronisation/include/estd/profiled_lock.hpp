@@ -0,0 +1,358 @@
+/* ============================================================================================================================ *//**
+ * @file       profiled_lock.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 2:24:47 pm
+ * @modified   Monday, 19th October 2026 2:24:47 pm
+ * @project    cpp-utils
+ * @brief      Definitions of the profiled_lock decorator collecting contention statistics of locks
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_PROFILED_LOCK_H__
+#define __ESTD_SYNCHRONISATION_PROFILED_LOCK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Private includes
+#include "estd/fixed_string.hpp"
+
+/* ======================================================== Configuration ========================================================= */
+
+/**
+ * @brief When defined to non-zero value, profiled_lock collects statistics by default; otherwise it
+ *    compiles down to the decorated lock
+ */
+#ifndef ESTD_LOCK_PROFILING
+#define ESTD_LOCK_PROFILING 0
+#endif
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================== Constants =========================================================== */
+
+/// Default state of the profiling of profiled_lock (see @ref ESTD_LOCK_PROFILING)
+inline constexpr bool lock_profiling = (ESTD_LOCK_PROFILING != 0);
+
+/* ========================================================== Statistics ========================================================== */
+
+/**
+ * @brief Snapshot of the statistics collected by the profiled_lock
+ */
+struct lock_statistics {
+
+    /// Number of acquisitions of the lock
+    std::uint64_t acquisitions { 0 };
+
+    /// Number of acquisitions that had to wait for another owner
+    std::uint64_t contended_acquisitions { 0 };
+
+    /// Total time spent waiting for the lock
+    std::chrono::nanoseconds total_wait { 0 };
+
+    /// Longest time the lock has been held
+    std::chrono::nanoseconds max_hold { 0 };
+
+    /// Merges statistics of the @p other lock (e.g. of another instance with the same name)
+    constexpr lock_statistics &operator+=(const lock_statistics &other) noexcept {
+        acquisitions           += other.acquisitions;
+        contended_acquisitions += other.contended_acquisitions;
+        total_wait             += other.total_wait;
+        max_hold                = std::max(max_hold, other.max_hold);
+        return *this;
+    }
+
+};
+
+namespace details {
+
+    /**
+     * @brief Statistics of the profiled_lock. Counters are written only by the owner of the lock (so plain
+     *    relaxed stores suffice) and may be read concurrently by anyone
+     */
+    struct lock_profile {
+
+        /// Number of acquisitions of the lock
+        std::atomic<std::uint64_t> acquisitions { 0 };
+
+        /// Number of acquisitions that had to wait for another owner
+        std::atomic<std::uint64_t> contended_acquisitions { 0 };
+
+        /// Total time spent waiting for the lock [ns]
+        std::atomic<std::int64_t> total_wait { 0 };
+
+        /// Longest time the lock has been held [ns]
+        std::atomic<std::int64_t> max_hold { 0 };
+
+        /// @returns snapshot of the statistics
+        inline lock_statistics snapshot() const noexcept;
+
+    };
+
+}
+
+/* ========================================================= lock_registry ======================================================== */
+
+template<typename Lock, basic_fixed_string Name = "", bool Enabled = lock_profiling>
+class profiled_lock;
+
+/**
+ * @brief Process-wide registry of named profiled_lock instances. Statistics of instances sharing the name
+ *    are reported together
+ */
+class lock_registry {
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    the global registry
+     */
+    static inline lock_registry &global() noexcept;
+
+    /// No copy-constructible
+    lock_registry(const lock_registry &other) = delete;
+    /// No copy-asignable
+    lock_registry &operator=(const lock_registry &other) = delete;
+
+    /**
+     * @returns
+     *    merged statistics of living locks registered under the @p name
+     */
+    inline lock_statistics statistics(std::string_view name) const;
+
+    /**
+     * @brief Calls @p function with the name and merged statistics of each group of living locks (in order
+     *    of the registration of the first lock of the group)
+     */
+    template<typename Function>
+        requires std::is_invocable_v<Function, std::string_view, const lock_statistics&>
+    inline void for_each(Function &&function) const;
+
+    /**
+     * @brief Writes statistics of all living locks to the @p stream (one line per name)
+     */
+    inline void dump(std::ostream &stream) const;
+
+private: /* -------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    template<typename Lock, basic_fixed_string Name, bool Enabled>
+    friend class profiled_lock;
+
+    lock_registry() = default;
+
+    /// Registers @p profile of the lock named @p name
+    inline void add(std::string_view name, const details::lock_profile &profile);
+
+    /// Unregisters @p profile
+    inline void remove(const details::lock_profile &profile) noexcept;
+
+private: /* ----------------------------------------------------- Private types --------------------------------------------------- */
+
+    /**
+     * @brief Registered lock
+     */
+    struct entry {
+
+        /// Name of the lock (refers to the template parameter object)
+        std::string_view name;
+
+        /// Statistics of the lock
+        const details::lock_profile *profile;
+
+    };
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Lock guarding list of entries
+    mutable std::mutex entries_lock;
+
+    /// Registered locks
+    std::vector<entry> entries;
+
+};
+
+/* ========================================================= profiled_lock ======================================================== */
+
+/**
+ * @brief Decorator of the @p Lock collecting its contention statistics: number of acquisitions (and of
+ *    those that had to wait), total wait time and maximal hold time. Lock is acquired with try_lock()
+ *    first; the clock is read around the blocking lock() only if the fast path fails, so the uncontended
+ *    acquisition costs two clock reads (the second one measures the hold time on unlock())
+ *
+ * @details Named locks register themselves in the lock_registry for the lifetime of the instance, so
+ *    statistics of all locks of the program can be dumped on demand:
+ *
+ *    @code
+ *
+ *    estd::profiled_lock<estd::spin_lock, "queue"> lock;
+ *    ...
+ *    estd::lock_registry::global().dump(std::cerr);
+ *
+ *    @endcode
+ *
+ * @tparam Lock
+ *    type of the decorated lock (providing lock(), try_lock() and unlock())
+ * @tparam Name
+ *    name of the lock in the lock_registry (unnamed locks are not registered)
+ * @tparam Enabled
+ *    if @c false, the decorator only forwards calls to the @p Lock
+ */
+template<typename Lock, basic_fixed_string Name, bool Enabled>
+class profiled_lock {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the decorated lock
+    using lock_type = Lock;
+
+    /// Clock used to measure wait and hold times
+    using clock = std::chrono::steady_clock;
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Constructs the decorated lock from @p args and registers the lock (if named)
+     */
+    template<typename... Args>
+        requires std::is_constructible_v<Lock, Args&&...>
+    inline explicit profiled_lock(Args&&... args);
+
+    /**
+     * @brief Unregisters the lock (if named)
+     */
+    inline ~profiled_lock();
+
+    /// No copy-constructible
+    profiled_lock(const profiled_lock &other) = delete;
+    /// No copy-asignable
+    profiled_lock &operator=(const profiled_lock &other) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Locks the lock
+     */
+    inline void lock();
+
+    /**
+     * @brief Tries to lock the lock without waiting
+     * @returns
+     *    @c true if the lock has been acquired
+     */
+    inline bool try_lock();
+
+    /**
+     * @brief Unlocks the lock
+     */
+    inline void unlock();
+
+    /**
+     * @returns
+     *    snapshot of the statistics of the lock
+     */
+    inline lock_statistics statistics() const noexcept;
+
+    /// @returns name of the lock
+    static constexpr std::string_view name() noexcept { return std::string_view{ Name }; }
+
+    /// @returns reference to the decorated lock
+    Lock &underlying() noexcept { return decorated; }
+
+private: /* -------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    /// Records acquisition of the lock (called by the owner)
+    inline void acquired(bool contended, clock::duration wait) noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Decorated lock
+    Lock decorated;
+
+    /// Statistics of the lock
+    details::lock_profile profile;
+
+    /// Moment of the last acquisition (accessed by the owner only)
+    clock::time_point acquisition;
+
+};
+
+/**
+ * @brief Specialization of the profiled_lock with profiling compiled out. Forwards all calls to the
+ *    decorated lock and reports empty statistics
+ */
+template<typename Lock, basic_fixed_string Name>
+class profiled_lock<Lock, Name, false> {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the decorated lock
+    using lock_type = Lock;
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Constructs the decorated lock from @p args
+     */
+    template<typename... Args>
+        requires std::is_constructible_v<Lock, Args&&...>
+    constexpr explicit profiled_lock(Args&&... args) : decorated( std::forward<Args>(args)... ) { }
+
+    /// No copy-constructible
+    profiled_lock(const profiled_lock &other) = delete;
+    /// No copy-asignable
+    profiled_lock &operator=(const profiled_lock &other) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /// Locks the lock
+    void lock() { decorated.lock(); }
+
+    /// Tries to lock the lock without waiting
+    bool try_lock() { return decorated.try_lock(); }
+
+    /// Unlocks the lock
+    void unlock() { decorated.unlock(); }
+
+    /// @returns empty statistics
+    constexpr lock_statistics statistics() const noexcept { return lock_statistics{ }; }
+
+    /// @returns name of the lock
+    static constexpr std::string_view name() noexcept { return std::string_view{ Name }; }
+
+    /// @returns reference to the decorated lock
+    Lock &underlying() noexcept { return decorated; }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Decorated lock
+    Lock decorated;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/profiled_lock/profiled_lock.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,211 @@
+/* ============================================================================================================================ *//**
+ * @file       profiled_lock.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 2:24:47 pm
+ * @modified   Monday, 19th October 2026 2:24:47 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the profiled_lock decorator
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_PROFILED_LOCK_PROFILED_LOCK_H__
+#define __ESTD_SYNCHRONISATION_PROFILED_LOCK_PROFILED_LOCK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <functional>
+// Private includes
+#include "estd/profiled_lock.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ========================================================== Statistics ========================================================== */
+
+namespace details {
+
+    lock_statistics lock_profile::snapshot() const noexcept {
+        return lock_statistics {
+            .acquisitions           = acquisitions.load(std::memory_order_relaxed),
+            .contended_acquisitions = contended_acquisitions.load(std::memory_order_relaxed),
+            .total_wait             = std::chrono::nanoseconds{ total_wait.load(std::memory_order_relaxed) },
+            .max_hold               = std::chrono::nanoseconds{ max_hold.load(std::memory_order_relaxed) },
+        };
+    }
+
+}
+
+/* ========================================================= lock_registry ======================================================== */
+
+lock_registry &lock_registry::global() noexcept {
+    static lock_registry instance;
+    return instance;
+}
+
+
+lock_statistics lock_registry::statistics(std::string_view name) const {
+
+    std::lock_guard guard{ entries_lock };
+
+    lock_statistics result;
+    for(auto &entry : entries) {
+        if(entry.name == name)
+            result += entry.profile->snapshot();
+    }
+
+    return result;
+}
+
+
+template<typename Function>
+    requires std::is_invocable_v<Function, std::string_view, const lock_statistics&>
+void lock_registry::for_each(Function &&function) const {
+
+    std::vector<std::pair<std::string_view, lock_statistics>> groups;
+
+    // Statistics are collected under the lock, but the function is called without holding it
+    {
+        std::lock_guard guard{ entries_lock };
+
+        for(auto &entry : entries) {
+
+            auto group = std::find_if(groups.begin(), groups.end(), [&entry](auto &group) {
+                return group.first == entry.name;
+            });
+
+            if(group == groups.end())
+                groups.emplace_back(entry.name, entry.profile->snapshot());
+            else
+                group->second += entry.profile->snapshot();
+        }
+    }
+
+    for(auto &[name, statistics] : groups)
+        std::invoke(function, name, std::as_const(statistics));
+}
+
+
+void lock_registry::dump(std::ostream &stream) const {
+    for_each([&stream](std::string_view name, const lock_statistics &statistics) {
+        stream << name
+               << ": acquisitions="  << statistics.acquisitions
+               << " contended="      << statistics.contended_acquisitions
+               << " total_wait="     << statistics.total_wait.count() << "ns"
+               << " max_hold="       << statistics.max_hold.count() << "ns"
+               << '\n';
+    });
+}
+
+
+void lock_registry::add(std::string_view name, const details::lock_profile &profile) {
+
+    std::lock_guard guard{ entries_lock };
+
+    entries.push_back(entry{ name, &profile });
+}
+
+
+void lock_registry::remove(const details::lock_profile &profile) noexcept {
+
+    std::lock_guard guard{ entries_lock };
+
+    std::erase_if(entries, [&profile](const entry &entry) { return entry.profile == &profile; });
+}
+
+/* ================================================ Public ctors, dtors & operators =============================================== */
+
+template<typename Lock, basic_fixed_string Name, bool Enabled>
+template<typename... Args>
+    requires std::is_constructible_v<Lock, Args&&...>
+profiled_lock<Lock, Name, Enabled>::profiled_lock(Args&&... args) :
+    decorated( std::forward<Args>(args)... )
+{
+    if constexpr(not Name.empty())
+        lock_registry::global().add(std::string_view{ Name }, profile);
+}
+
+
+template<typename Lock, basic_fixed_string Name, bool Enabled>
+profiled_lock<Lock, Name, Enabled>::~profiled_lock() {
+    if constexpr(not Name.empty())
+        lock_registry::global().remove(profile);
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename Lock, basic_fixed_string Name, bool Enabled>
+void profiled_lock<Lock, Name, Enabled>::lock() {
+
+    // Uncontended acquisition does not pay for measuring the wait
+    if(decorated.try_lock()) {
+        acquired(false, clock::duration::zero());
+        return;
+    }
+
+    auto start = clock::now();
+    decorated.lock();
+    acquired(true, clock::now() - start);
+}
+
+
+template<typename Lock, basic_fixed_string Name, bool Enabled>
+bool profiled_lock<Lock, Name, Enabled>::try_lock() {
+
+    if(not decorated.try_lock())
+        return false;
+
+    acquired(false, clock::duration::zero());
+
+    return true;
+}
+
+
+template<typename Lock, basic_fixed_string Name, bool Enabled>
+void profiled_lock<Lock, Name, Enabled>::unlock() {
+
+    auto hold = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - acquisition).count();
+
+    // Counters are modified only by the owner, so no read-modify-write is needed
+    if(hold > profile.max_hold.load(std::memory_order_relaxed))
+        profile.max_hold.store(hold, std::memory_order_relaxed);
+
+    decorated.unlock();
+}
+
+
+template<typename Lock, basic_fixed_string Name, bool Enabled>
+lock_statistics profiled_lock<Lock, Name, Enabled>::statistics() const noexcept {
+    return profile.snapshot();
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+template<typename Lock, basic_fixed_string Name, bool Enabled>
+void profiled_lock<Lock, Name, Enabled>::acquired(bool contended, clock::duration wait) noexcept {
+
+    profile.acquisitions.store(profile.acquisitions.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if(contended) {
+        profile.contended_acquisitions.store(
+            profile.contended_acquisitions.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        profile.total_wait.store(
+            profile.total_wait.load(std::memory_order_relaxed) +
+            std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count(), std::memory_order_relaxed);
+    }
+
+    acquisition = clock::now();
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
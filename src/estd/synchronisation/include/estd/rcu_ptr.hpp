@@ -0,0 +1,368 @@
+/* ============================================================================================================================ *//**
+ * @file       rcu_ptr.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 12:41:26 pm
+ * @modified   Monday, 19th October 2026 7:21:04 pm
+ * @project    cpp-utils
+ * @brief      Definition of the rcu_ptr class template - read-copy-update holder of read-mostly objects
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_RCU_PTR_H__
+#define __ESTD_SYNCHRONISATION_RCU_PTR_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+// Private includes
+#include "estd/locks.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ======================================================== Auxiliary types ======================================================= */
+
+namespace details::rcu {
+
+    /**
+     * @brief Per-thread record of the read-side critical section
+     */
+    struct alignas(cache_line_size) thread_record {
+
+        /// Global epoch observed when the outermost read section was entered (0 if the thread is quiescent)
+        std::atomic<std::uint64_t> epoch { 0 };
+
+        /// Flag set while the record is owned by a living thread
+        std::atomic<bool> used { false };
+
+        /// Depth of nested read sections (accessed by the owning thread only)
+        unsigned nesting { 0 };
+
+        /// Next record of the registry (immutable once the record is published)
+        thread_record *next { nullptr };
+
+    };
+
+    /**
+     * @brief Process-wide registry of thread records along with the global epoch. Records are never
+     *    freed while the domain lives - threads that exit return them for reuse
+     */
+    class domain {
+    public:
+
+        domain() = default;
+        domain(const domain &other) = delete;
+        domain &operator=(const domain &other) = delete;
+        inline ~domain();
+
+        /// @returns unused record (reused or newly registered) owned by the calling thread
+        inline thread_record &acquire_record();
+
+        /// Returns the @p record to the pool
+        inline void release_record(thread_record &record) noexcept;
+
+        /// @returns current global epoch
+        std::uint64_t current() const noexcept { return epoch.load(std::memory_order_acquire); }
+
+        /// Advances the global epoch @returns the new epoch
+        std::uint64_t advance() noexcept { return epoch.fetch_add(1, std::memory_order_seq_cst) + 1; }
+
+        /// @returns the oldest epoch observed by threads inside read sections (UINT64_MAX if there is none)
+        inline std::uint64_t oldest_reader() const noexcept;
+
+    private:
+
+        /// Global epoch (starts from 1 as 0 marks quiescent records)
+        std::atomic<std::uint64_t> epoch { 1 };
+
+        /// Head of the push-only list of records
+        std::atomic<thread_record*> records { nullptr };
+
+    };
+
+    /// @returns domain shared by all rcu_ptr objects
+    inline domain &default_domain() noexcept;
+
+    /// @returns record of the calling thread in the default domain
+    inline thread_record &this_thread_record();
+
+    /// Enters the read section
+    inline void pin() noexcept;
+
+    /// Leaves the read section
+    inline void unpin() noexcept;
+
+}
+
+/* ============================================================ rcu_ptr =========================================================== */
+
+/**
+ * @brief Read-copy-update holder of the object that is read very often and replaced rarely (configuration,
+ *    routing tables, calibration data). Readers are wait-free: read() marks the calling thread's epoch
+ *    record and loads the atomic pointer - no lock is taken and no shared cache line is written. Writers
+ *    (serialized with the @p Lock) publish a new immutable copy and retire the old one, which is deleted
+ *    after the grace period, i.e. once every thread that might have been reading it has left its read
+ *    section.
+ *
+ *    @code
+ *
+ *    estd::rcu_ptr<routing_table> routes{ std::make_unique<routing_table>(load_routes()) };
+ *
+ *    // Reader (any thread)
+ *    if(auto table = routes.read(); table)
+ *        forward(packet, table->lookup(packet.destination));
+ *
+ *    // Writer - copy is published when the guard is destroyed
+ *    {
+ *        auto table = routes.write();
+ *        table->add(destination, next_hop);
+ *    }
+ *
+ *    @endcode
+ *
+ * @note Read guards must not outlive the thread that created them and the thread holding one must not
+ *    call synchronize()
+ *
+ * @tparam T
+ *    type of the held object
+ * @tparam Lock
+ *    type of the lock serializing writers
+ */
+template<typename T, typename Lock = std::mutex>
+class rcu_ptr {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the held object
+    using element_type = T;
+
+    /// Type of the lock serializing writers
+    using lock_type = Lock;
+
+    /**
+     * @brief RAII read section giving const access to the object published at the moment of its creation.
+     *    The object is guaranteed to live for as long as the guard does
+     */
+    class read_guard {
+
+        friend class rcu_ptr;
+
+    public:
+
+        /// No copy-constructible
+        read_guard(const read_guard &other) = delete;
+        /// No copy-asignable
+        read_guard &operator=(const read_guard &other) = delete;
+
+        /// Leaves the read section
+        ~read_guard() { details::rcu::unpin(); }
+
+        /// @returns pointer to the object (@c nullptr if the rcu_ptr was empty)
+        const T *get() const noexcept { return object; }
+
+        /// @returns pointer to the object
+        const T *operator->() const noexcept { return object; }
+
+        /// @returns reference to the object
+        const T &operator*() const noexcept { return *object; }
+
+        /// @returns @c true if the guard refers to an object
+        explicit operator bool() const noexcept { return object != nullptr; }
+
+    private:
+
+        /// Enters the read section and loads the object
+        explicit read_guard(const std::atomic<T*> &current) noexcept :
+            object{ (details::rcu::pin(), current.load(std::memory_order_seq_cst)) }
+        { }
+
+        /// Object observed by the reader
+        const T *object;
+
+    };
+
+    /**
+     * @brief RAII write section modelled after the estd::synchronised_reference - holds the writer lock
+     *    and a private copy of the object which is published (and the previous object retired) when
+     *    the guard is destroyed. If the guard is destroyed by the exception thrown during modification,
+     *    the copy is discarded instead. Movable but non-copyable
+     */
+    class write_guard {
+
+        friend class rcu_ptr;
+
+    public:
+
+        /// No copy-constructible
+        write_guard(const write_guard &other) = delete;
+        /// No copy-asignable
+        write_guard &operator=(const write_guard &other) = delete;
+        /// Move-constructible
+        write_guard(write_guard &&other) noexcept = default;
+
+        /// Publishes the modified copy (unless the stack is unwound by the exception thrown after the guard was created)
+        ~write_guard() {
+            if(copy != nullptr and std::uncaught_exceptions() == exceptions)
+                owner->publish(copy.release());
+        }
+
+        /// @returns reference to the modified copy
+        T &get() noexcept { return *copy; }
+
+        /// @returns pointer to the modified copy
+        T *operator->() noexcept { return copy.get(); }
+
+        /// @returns reference to the modified copy
+        T &operator*() noexcept { return *copy; }
+
+    private:
+
+        /// Locks writers out and copies the current object
+        inline explicit write_guard(rcu_ptr &owner);
+
+        /// Modified object
+        rcu_ptr *owner;
+
+        /// Writer lock held by the guard
+        std::unique_lock<Lock> guard;
+
+        /// Copy of the object being modified
+        std::unique_ptr<T> copy;
+
+        /// Number of exceptions in flight when the guard was created
+        int exceptions;
+
+    };
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Constructs empty holder
+     */
+    rcu_ptr() = default;
+
+    /**
+     * @brief Constructs holder taking ownership of the @p object
+     */
+    explicit rcu_ptr(std::unique_ptr<T> object) noexcept;
+
+    /// No copy-constructible
+    rcu_ptr(const rcu_ptr &other) = delete;
+    /// No copy-asignable
+    rcu_ptr &operator=(const rcu_ptr &other) = delete;
+
+    /**
+     * @brief Deletes current and retired objects
+     * @note No reader may access the holder while it is destroyed
+     */
+    ~rcu_ptr();
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Enters the read section (wait-free)
+     * @returns
+     *    guard giving access to the current object
+     */
+    inline read_guard read() const noexcept;
+
+    /**
+     * @brief Starts modification of the copy of the current object (the holder must not be empty)
+     * @returns
+     *    guard holding the writer lock; the copy is published when the guard is destroyed
+     */
+    inline write_guard write() requires std::is_copy_constructible_v<T>;
+
+    /**
+     * @brief Publishes copy of the current object modified by the @p modify (nothing is published if
+     *    @p modify throws)
+     */
+    template<typename Modify>
+        requires (std::is_copy_constructible_v<T> and std::is_invocable_v<Modify, T&>)
+    inline void update(Modify &&modify);
+
+    /**
+     * @brief Publishes the @p object (may be @c nullptr) retiring the current one
+     */
+    inline void store(std::unique_ptr<T> object);
+
+    /**
+     * @brief Publishes the object constructed from @p args retiring the current one
+     */
+    template<typename... Args>
+        requires std::is_constructible_v<T, Args&&...>
+    inline void emplace(Args&&... args);
+
+    /**
+     * @brief Waits until the grace period of all objects retired so far elapses and deletes them
+     */
+    inline void synchronize();
+
+    /**
+     * @returns
+     *    number of retired objects still waiting for the end of their grace period
+     */
+    inline std::size_t retired_count() const;
+
+private: /* --------------------------------------------------- Private types ----------------------------------------------------- */
+
+    /**
+     * @brief Object replaced by the writer
+     */
+    struct retired_object {
+
+        /// Retired object
+        T *object;
+
+        /// Epoch started after the object has been unpublished
+        std::uint64_t epoch;
+
+    };
+
+private: /* --------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    /**
+     * @brief Publishes the @p object retiring the current one (the writer lock has to be held)
+     */
+    inline void publish(T *object);
+
+    /**
+     * @brief Deletes retired objects whose grace period has elapsed (the writer lock has to be held)
+     */
+    inline void reclaim() noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Published object
+    std::atomic<T*> current { nullptr };
+
+    /// Lock serializing writers
+    mutable Lock writer_lock;
+
+    /// Objects waiting for the end of their grace period
+    std::vector<retired_object> retired;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/rcu_ptr/rcu_ptr.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
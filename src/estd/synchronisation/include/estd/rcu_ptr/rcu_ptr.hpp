@@ -0,0 +1,267 @@
+/* ============================================================================================================================ *//**
+ * @file       rcu_ptr.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 12:41:26 pm
+ * @modified   Monday, 19th October 2026 7:21:04 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the rcu_ptr class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_RCU_PTR_RCU_PTR_H__
+#define __ESTD_SYNCHRONISATION_RCU_PTR_RCU_PTR_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <utility>
+// Private includes
+#include "estd/rcu_ptr.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ======================================================== Auxiliary types ======================================================= */
+
+namespace details::rcu {
+
+    domain::~domain() {
+        for(auto *record = records.load(std::memory_order_acquire); record != nullptr;)
+            delete std::exchange(record, record->next);
+    }
+
+
+    thread_record &domain::acquire_record() {
+
+        // Reuse record of the thread that has exited
+        for(auto *record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            bool expected = false;
+            if(not record->used.load(std::memory_order_relaxed) and
+                record->used.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return *record;
+            }
+        }
+
+        auto *record = new thread_record;
+        record->used.store(true, std::memory_order_relaxed);
+
+        record->next = records.load(std::memory_order_relaxed);
+        while(not records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed));
+
+        return *record;
+    }
+
+
+    void domain::release_record(thread_record &record) noexcept {
+        assert(record.nesting == 0);
+        record.used.store(false, std::memory_order_release);
+    }
+
+
+    std::uint64_t domain::oldest_reader() const noexcept {
+
+        std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+
+        for(auto *record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            // Pairs with the store in pin() - either the reader is seen or it will see the newly published object
+            if(std::uint64_t observed = record->epoch.load(std::memory_order_seq_cst); observed != 0)
+                oldest = std::min(oldest, observed);
+        }
+
+        return oldest;
+    }
+
+
+    domain &default_domain() noexcept {
+        static domain instance;
+        return instance;
+    }
+
+
+    thread_record &this_thread_record() {
+
+        /**
+         * @brief Owner of the calling thread's record returning it to the domain on thread's exit
+         */
+        struct record_owner {
+
+            record_owner() : record{ default_domain().acquire_record() } { }
+            ~record_owner() { default_domain().release_record(record); }
+
+            thread_record &record;
+        };
+
+        thread_local record_owner owner;
+
+        return owner.record;
+    }
+
+
+    void pin() noexcept {
+
+        auto &record = this_thread_record();
+
+        /**
+         * Only the outermost section is recorded. Store has to be sequentially consistent so that
+         * the writer scanning records after unpublishing the object either sees the reader or the
+         * reader sees the new object
+         */
+        if(record.nesting++ == 0)
+            record.epoch.store(default_domain().current(), std::memory_order_seq_cst);
+    }
+
+
+    void unpin() noexcept {
+
+        auto &record = this_thread_record();
+
+        if(--record.nesting == 0)
+            record.epoch.store(0, std::memory_order_release);
+    }
+
+}
+
+/* ================================================ Public ctors, dtors & operators =============================================== */
+
+template<typename T, typename Lock>
+rcu_ptr<T, Lock>::rcu_ptr(std::unique_ptr<T> object) noexcept :
+    current{ object.release() }
+{ }
+
+
+template<typename T, typename Lock>
+rcu_ptr<T, Lock>::~rcu_ptr() {
+
+    delete current.load(std::memory_order_relaxed);
+
+    for(auto &entry : retired)
+        delete entry.object;
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename T, typename Lock>
+typename rcu_ptr<T, Lock>::read_guard rcu_ptr<T, Lock>::read() const noexcept {
+    return read_guard{ current };
+}
+
+
+template<typename T, typename Lock>
+typename rcu_ptr<T, Lock>::write_guard rcu_ptr<T, Lock>::write() requires std::is_copy_constructible_v<T> {
+    return write_guard{ *this };
+}
+
+
+template<typename T, typename Lock>
+template<typename Modify>
+    requires (std::is_copy_constructible_v<T> and std::is_invocable_v<Modify, T&>)
+void rcu_ptr<T, Lock>::update(Modify &&modify) {
+    auto writer = write();
+    std::invoke(std::forward<Modify>(modify), writer.get());
+}
+
+
+template<typename T, typename Lock>
+void rcu_ptr<T, Lock>::store(std::unique_ptr<T> object) {
+
+    std::lock_guard guard{ writer_lock };
+
+    publish(object.release());
+}
+
+
+template<typename T, typename Lock>
+template<typename... Args>
+    requires std::is_constructible_v<T, Args&&...>
+void rcu_ptr<T, Lock>::emplace(Args&&... args) {
+    store(std::make_unique<T>(std::forward<Args>(args)...));
+}
+
+
+template<typename T, typename Lock>
+void rcu_ptr<T, Lock>::synchronize() {
+
+    // Thread inside the read section would wait for itself
+    assert(details::rcu::this_thread_record().nesting == 0);
+
+    std::lock_guard guard{ writer_lock };
+
+    spin_backoff backoff;
+
+    for(reclaim(); not retired.empty(); reclaim())
+        backoff();
+}
+
+
+template<typename T, typename Lock>
+std::size_t rcu_ptr<T, Lock>::retired_count() const {
+
+    std::lock_guard guard{ writer_lock };
+
+    return retired.size();
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+template<typename T, typename Lock>
+rcu_ptr<T, Lock>::write_guard::write_guard(rcu_ptr &owner) :
+    owner{ &owner },
+    guard{ owner.writer_lock },
+    exceptions{ std::uncaught_exceptions() }
+{
+    const T *object = owner.current.load(std::memory_order_relaxed);
+
+    assert(object != nullptr);
+
+    copy = std::make_unique<T>(*object);
+}
+
+
+template<typename T, typename Lock>
+void rcu_ptr<T, Lock>::publish(T *object) {
+
+    T *previous = current.exchange(object, std::memory_order_seq_cst);
+
+    /**
+     * Readers that enter their sections in the new epoch are guaranteed to observe the new object,
+     * so the previous one can be deleted once no reader remains in the older epochs
+     */
+    if(previous != nullptr)
+        retired.push_back(retired_object{ previous, details::rcu::default_domain().advance() });
+
+    reclaim();
+}
+
+
+template<typename T, typename Lock>
+void rcu_ptr<T, Lock>::reclaim() noexcept {
+
+    if(retired.empty())
+        return;
+
+    std::uint64_t oldest = details::rcu::default_domain().oldest_reader();
+
+    std::erase_if(retired, [oldest](const retired_object &entry) {
+        if(entry.epoch > oldest)
+            return false;
+        delete entry.object;
+        return true;
+    });
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
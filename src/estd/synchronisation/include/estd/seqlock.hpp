@@ -0,0 +1,167 @@
+/* ============================================================================================================================ *//**
+ * @file       seqlock.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 10:18:50 am
+ * @modified   Monday, 19th October 2026 7:05:38 pm
+ * @project    cpp-utils
+ * @brief      Definition of the seqlock class template - sequence lock guarding trivially copyable value
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_SEQLOCK_H__
+#define __ESTD_SYNCHRONISATION_SEQLOCK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+// Private includes
+#include "estd/locks.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ============================================================ seqlock =========================================================== */
+
+/**
+ * @brief Sequence lock guarding a trivially copyable value. Writers serialize on the sequence counter (it is
+ *    odd while a write is in progress) while readers never write shared memory - they copy the value and
+ *    retry if the counter has changed in the meantime. This makes reads of small, frequently read and rarely
+ *    written values (configuration, timestamps, statistics) scale with the number of readers, as opposed
+ *    to the reader-writer lock whose readers contend on the reader count.
+ *
+ * @note The value is kept as an array of words accessed with relaxed atomic operations so that copying it
+ *    while being written is not a data race; the torn copy is simply discarded
+ *
+ * @tparam T
+ *    type of the guarded value
+ */
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+class alignas(cache_line_size) seqlock {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the guarded value
+    using value_type = T;
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Constructs the lock holding value-initialized object
+     */
+    seqlock() noexcept requires std::is_default_constructible_v<T>;
+
+    /**
+     * @brief Constructs the lock holding the @p value
+     * @param wait
+     *    behaviour of waiters once the backoff has reached its limit
+     */
+    explicit seqlock(const T &value, spin_wait wait = spin_wait::yield) noexcept;
+
+    /// No copy-constructible
+    seqlock(const seqlock &other) = delete;
+    /// No copy-asignable
+    seqlock &operator=(const seqlock &other) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    consistent copy of the value (retries while the value is being written)
+     */
+    inline T load() const noexcept;
+
+    /**
+     * @brief Tries to copy the value without waiting
+     * @param value
+     *    output object; left unchanged if the read failed
+     * @returns
+     *    @c true if consistent copy has been written to the @p value, @c false if the value has been
+     *    written concurrently
+     */
+    inline bool try_load(T &value) const noexcept;
+
+    /**
+     * @brief Replaces the value with @p value
+     */
+    inline void store(const T &value) noexcept;
+
+    /**
+     * @brief Modifies the value in place calling @p modify with the reference to its copy inside the write
+     *    section (i.e. read-modify-write that is atomic with respect to other writers). If @p modify throws,
+     *    the value is not modified
+     */
+    template<typename Modify>
+        requires std::is_invocable_v<Modify, T&>
+    inline void update(Modify &&modify);
+
+private: /* --------------------------------------------------- Private types ----------------------------------------------------- */
+
+    /// Unit of the value's storage
+    using word = std::uintptr_t;
+
+    /// Number of words required to hold the value
+    static constexpr std::size_t words = (sizeof(T) + sizeof(word) - 1) / sizeof(word);
+
+    /// Non-atomic copy of the storage
+    using buffer = std::array<word, words>;
+
+private: /* --------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    /**
+     * @brief Waits for the end of the current write and enters the write section
+     * @returns
+     *    (even) value of the sequence counter before the write section
+     */
+    inline std::uint64_t begin_write() noexcept;
+
+    /**
+     * @brief Leaves the write section entered when the sequence counter was equal to @p sequence
+     */
+    inline void end_write(std::uint64_t sequence) noexcept;
+
+    /// Copies the storage into the @p out with relaxed loads
+    inline void read_words(buffer &out) const noexcept;
+
+    /// Copies the @p in into the storage with relaxed stores
+    inline void write_words(const buffer &in) noexcept;
+
+    /// Converts @p value into the buffer
+    static inline buffer to_buffer(const T &value) noexcept;
+
+    /// Converts the @p in buffer into the value
+    static inline T from_buffer(const buffer &in) noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Sequence counter (odd while the write is in progress)
+    std::atomic<std::uint64_t> sequence { 0 };
+
+    /// Storage of the value
+    std::array<std::atomic<word>, words> data;
+
+    /// Behaviour of waiters once the backoff has reached its limit
+    spin_wait wait;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/seqlock/seqlock.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
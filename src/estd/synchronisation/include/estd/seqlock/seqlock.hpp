@@ -0,0 +1,211 @@
+/* ============================================================================================================================ *//**
+ * @file       seqlock.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 10:18:50 am
+ * @modified   Monday, 19th October 2026 7:05:38 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the seqlock class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_SEQLOCK_SEQLOCK_H__
+#define __ESTD_SYNCHRONISATION_SEQLOCK_SEQLOCK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <bit>
+#include <cstring>
+#include <functional>
+// Private includes
+#include "estd/seqlock.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ================================================ Public ctors, dtors & operators =============================================== */
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+seqlock<T>::seqlock() noexcept requires std::is_default_constructible_v<T> :
+    seqlock{ T{ } }
+{ }
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+seqlock<T>::seqlock(const T &value, spin_wait wait) noexcept :
+    wait{ wait }
+{
+    write_words(to_buffer(value));
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+T seqlock<T>::load() const noexcept {
+
+    spin_backoff backoff{ wait };
+
+    buffer copy;
+
+    for(;;) {
+
+        std::uint64_t before = sequence.load(std::memory_order_acquire);
+
+        if((before & 1) == 0) {
+
+            read_words(copy);
+
+            // Orders loads of the value before the second load of the counter
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if(sequence.load(std::memory_order_relaxed) == before)
+                return from_buffer(copy);
+        }
+
+        backoff();
+    }
+}
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+bool seqlock<T>::try_load(T &value) const noexcept {
+
+    std::uint64_t before = sequence.load(std::memory_order_acquire);
+
+    if((before & 1) != 0)
+        return false;
+
+    buffer copy;
+    read_words(copy);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if(sequence.load(std::memory_order_relaxed) != before)
+        return false;
+
+    value = from_buffer(copy);
+
+    return true;
+}
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+void seqlock<T>::store(const T &value) noexcept {
+
+    buffer copy = to_buffer(value);
+
+    std::uint64_t current = begin_write();
+    write_words(copy);
+    end_write(current);
+}
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+template<typename Modify>
+    requires std::is_invocable_v<Modify, T&>
+void seqlock<T>::update(Modify &&modify) {
+
+    // Ends the write section also when modify throws (the value is left untouched then)
+    struct section_guard {
+        seqlock &lock;
+        std::uint64_t current;
+        ~section_guard() { lock.end_write(current); }
+    } guard { *this, begin_write() };
+
+    // Value cannot change while the write section is held
+    buffer copy;
+    read_words(copy);
+
+    T value = from_buffer(copy);
+    std::invoke(std::forward<Modify>(modify), value);
+
+    write_words(to_buffer(value));
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+std::uint64_t seqlock<T>::begin_write() noexcept {
+
+    spin_backoff backoff{ wait };
+
+    for(std::uint64_t current = sequence.load(std::memory_order_relaxed);;) {
+
+        if((current & 1) == 0 and
+            sequence.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            // Orders the odd counter before stores of the value (pairs with the fence in load())
+            std::atomic_thread_fence(std::memory_order_release);
+            return current;
+        }
+
+        backoff();
+
+        current = sequence.load(std::memory_order_relaxed);
+    }
+}
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+void seqlock<T>::end_write(std::uint64_t current) noexcept {
+    sequence.store(current + 2, std::memory_order_release);
+}
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+void seqlock<T>::read_words(buffer &out) const noexcept {
+    for(std::size_t i = 0; i < words; ++i)
+        out[i] = data[i].load(std::memory_order_relaxed);
+}
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+void seqlock<T>::write_words(const buffer &in) noexcept {
+    for(std::size_t i = 0; i < words; ++i)
+        data[i].store(in[i], std::memory_order_relaxed);
+}
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+typename seqlock<T>::buffer seqlock<T>::to_buffer(const T &value) noexcept {
+
+    buffer out{ };
+    std::memcpy(out.data(), &value, sizeof(T));
+
+    return out;
+}
+
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+T seqlock<T>::from_buffer(const buffer &in) noexcept {
+
+    std::array<std::byte, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), in.data(), sizeof(T));
+
+    // T is not required to be default-constructible
+    return std::bit_cast<T>(bytes);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
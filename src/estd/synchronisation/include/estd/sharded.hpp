@@ -0,0 +1,241 @@
+/* ============================================================================================================================ *//**
+ * @file       sharded.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 3:16:05 pm
+ * @modified   Monday, 19th October 2026 3:16:05 pm
+ * @project    cpp-utils
+ * @brief      Definitions of the sharded accumulators spreading updates of hot shared values over cache lines
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_SHARDED_H__
+#define __ESTD_SYNCHRONISATION_SHARDED_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+// Private includes
+#include "estd/locks.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ======================================================== Auxiliary types ======================================================= */
+
+/**
+ * @brief Policy of selecting the shard updated by the calling thread
+ */
+enum class shard_policy {
+
+    /// Threads are assigned shards round-robin at their first update
+    thread,
+
+    /// Shard is selected by the CPU the thread runs on (falls back to @ref thread on platforms other than Linux)
+    cpu,
+
+};
+
+namespace details::sharded {
+
+    /// @returns default number of shards (number of hardware threads rounded up to the power of 2)
+    inline std::size_t default_shards() noexcept;
+
+    /// @returns index of the calling thread assigned round-robin at the first call
+    inline std::size_t this_thread_index() noexcept;
+
+    /// @returns index of the shard selected for the calling thread by the @p Policy
+    template<shard_policy Policy>
+    inline std::size_t this_shard_index() noexcept;
+
+}
+
+/* ============================================================ sharded =========================================================== */
+
+/**
+ * @brief Value split into shards (each in its own cache line) updated by threads independently. Threads
+ *    update their local shard with relaxed atomic operations, so frequent updates do not bounce the cache
+ *    line between cores; reading the value aggregates all shards and is correspondingly more expensive.
+ *    Intended for hot statistics that are written much more often than read.
+ *
+ * @note Aggregate read is not an atomic snapshot - updates performed concurrently with the read may or may
+ *    not be included in the result
+ *
+ * @tparam T
+ *    type of the value (trivially copyable)
+ * @tparam Policy
+ *    policy of selecting the shard updated by the calling thread
+ * @tparam CachelineSize
+ *    size of the cache line the shards are padded to
+ */
+template<
+    typename T,
+    shard_policy Policy = shard_policy::thread,
+    std::size_t CachelineSize = cache_line_size
+> requires std::is_trivially_copyable_v<T>
+class sharded {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the value
+    using value_type = T;
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Constructs the value with all shards set to @p value
+     * @param value
+     *    initial value of each shard (neutral element of the aggregation, e.g. 0 for sums)
+     * @param shards
+     *    number of shards (rounded up to the power of 2)
+     */
+    inline explicit sharded(T value = T{ }, std::size_t shards = details::sharded::default_shards());
+
+    /// No copy-constructible
+    sharded(const sharded &other) = delete;
+    /// No copy-asignable
+    sharded &operator=(const sharded &other) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Adds @p value to the local shard
+     */
+    inline void add(T value) noexcept requires (std::integral<T> or std::floating_point<T>);
+
+    /**
+     * @brief Replaces value of the local shard with the result of @p function called with its current value
+     * @note @p function may be called more than once if the shard is updated concurrently
+     */
+    template<typename Update>
+        requires std::is_invocable_r_v<T, Update&, T>
+    inline void update(Update &&function);
+
+    /**
+     * @returns
+     *    sum of all shards
+     */
+    inline T load() const noexcept requires (std::integral<T> or std::floating_point<T>);
+
+    /**
+     * @returns
+     *    result of folding values of all shards with @p function starting from the @p init
+     */
+    template<typename Reduce>
+        requires std::is_invocable_r_v<T, Reduce&, T, T>
+    inline T reduce(T init, Reduce &&function) const;
+
+    /**
+     * @brief Sets all shards to @p value (neutral element of the aggregation)
+     */
+    inline void reset(T value = T{ }) noexcept;
+
+    /// @returns number of shards
+    std::size_t shards() const noexcept { return mask + 1; }
+
+private: /* ----------------------------------------------------- Private types --------------------------------------------------- */
+
+    /**
+     * @brief Single shard occupying the whole cache line
+     */
+    struct alignas(CachelineSize) shard {
+
+        /// Value of the shard
+        std::atomic<T> value;
+
+    };
+
+private: /* -------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    /// @returns shard of the calling thread
+    shard &local() noexcept { return slots[details::sharded::this_shard_index<Policy>() & mask]; }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Mask of the shard index
+    std::size_t mask;
+
+    /// Shards
+    std::unique_ptr<shard[]> slots;
+
+};
+
+/* ======================================================== sharded_counter ======================================================= */
+
+/**
+ * @brief Event counter with the scalable increment (see @ref sharded)
+ *
+ *    @code
+ *
+ *    inline estd::sharded_counter requests;
+ *    ...
+ *    ++requests;
+ *    ...
+ *    report(requests.load());
+ *
+ *    @endcode
+ */
+template<shard_policy Policy = shard_policy::thread, std::size_t CachelineSize = cache_line_size>
+class basic_sharded_counter {
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Constructs the counter with the zero value
+     * @param shards
+     *    number of shards (rounded up to the power of 2)
+     */
+    explicit basic_sharded_counter(std::size_t shards = details::sharded::default_shards()) :
+        counts{ 0, shards }
+    { }
+
+    /// Increments the counter
+    basic_sharded_counter &operator++() noexcept { counts.add(1); return *this; }
+
+    /// Adds @p value to the counter
+    basic_sharded_counter &operator+=(std::uint64_t value) noexcept { counts.add(value); return *this; }
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /// Adds @p value to the counter
+    void add(std::uint64_t value = 1) noexcept { counts.add(value); }
+
+    /// @returns value of the counter (sum of all shards)
+    std::uint64_t load() const noexcept { return counts.load(); }
+
+    /// Resets the counter to zero
+    void reset() noexcept { counts.reset(); }
+
+    /// @returns number of shards
+    std::size_t shards() const noexcept { return counts.shards(); }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Shards of the counter
+    sharded<std::uint64_t, Policy, CachelineSize> counts;
+
+};
+
+/// Sharded counter with the default policy
+using sharded_counter = basic_sharded_counter<>;
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/sharded/sharded.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
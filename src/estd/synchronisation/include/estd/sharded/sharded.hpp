@@ -0,0 +1,144 @@
+/* ============================================================================================================================ *//**
+ * @file       sharded.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 3:16:05 pm
+ * @modified   Monday, 19th October 2026 3:16:05 pm
+ * @project    cpp-utils
+ * @brief      Implementation of the sharded accumulators
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_SHARDED_SHARDED_H__
+#define __ESTD_SYNCHRONISATION_SHARDED_SHARDED_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <functional>
+#include <thread>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+// Private includes
+#include "estd/sharded.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ======================================================== Auxiliary types ======================================================= */
+
+namespace details::sharded {
+
+    std::size_t default_shards() noexcept {
+
+        static const std::size_t shards =
+            std::bit_ceil(std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+
+        return shards;
+    }
+
+
+    std::size_t this_thread_index() noexcept {
+
+        static std::atomic<std::size_t> next { 0 };
+
+        // Consecutive threads get consecutive indices, so up to the number of shards threads never share one
+        thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+
+        return index;
+    }
+
+
+    template<shard_policy Policy>
+    std::size_t this_shard_index() noexcept {
+
+        #if defined(__linux__)
+        if constexpr(Policy == shard_policy::cpu) {
+            // Thread may migrate right after the call, so shards are still updated atomically
+            if(int cpu = sched_getcpu(); cpu >= 0)
+                return static_cast<std::size_t>(cpu);
+        }
+        #endif
+
+        return this_thread_index();
+    }
+
+}
+
+/* ================================================ Public ctors, dtors & operators =============================================== */
+
+template<typename T, shard_policy Policy, std::size_t CachelineSize>
+    requires std::is_trivially_copyable_v<T>
+sharded<T, Policy, CachelineSize>::sharded(T value, std::size_t shards) :
+    mask{ std::bit_ceil(std::max<std::size_t>(shards, 1)) - 1 },
+    slots{ std::make_unique<shard[]>(mask + 1) }
+{
+    reset(value);
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename T, shard_policy Policy, std::size_t CachelineSize>
+    requires std::is_trivially_copyable_v<T>
+void sharded<T, Policy, CachelineSize>::add(T value) noexcept requires (std::integral<T> or std::floating_point<T>) {
+    local().value.fetch_add(value, std::memory_order_relaxed);
+}
+
+
+template<typename T, shard_policy Policy, std::size_t CachelineSize>
+    requires std::is_trivially_copyable_v<T>
+template<typename Update>
+    requires std::is_invocable_r_v<T, Update&, T>
+void sharded<T, Policy, CachelineSize>::update(Update &&function) {
+
+    auto &shard = local();
+
+    T current = shard.value.load(std::memory_order_relaxed);
+
+    // Shard is contended only by threads sharing it, so the loop rarely repeats
+    while(not shard.value.compare_exchange_weak(current, std::invoke(function, current),
+        std::memory_order_relaxed, std::memory_order_relaxed));
+}
+
+
+template<typename T, shard_policy Policy, std::size_t CachelineSize>
+    requires std::is_trivially_copyable_v<T>
+T sharded<T, Policy, CachelineSize>::load() const noexcept requires (std::integral<T> or std::floating_point<T>) {
+    return reduce(T{ }, std::plus<T>{ });
+}
+
+
+template<typename T, shard_policy Policy, std::size_t CachelineSize>
+    requires std::is_trivially_copyable_v<T>
+template<typename Reduce>
+    requires std::is_invocable_r_v<T, Reduce&, T, T>
+T sharded<T, Policy, CachelineSize>::reduce(T init, Reduce &&function) const {
+
+    for(std::size_t i = 0; i <= mask; ++i)
+        init = std::invoke(function, init, slots[i].value.load(std::memory_order_relaxed));
+
+    return init;
+}
+
+
+template<typename T, shard_policy Policy, std::size_t CachelineSize>
+    requires std::is_trivially_copyable_v<T>
+void sharded<T, Policy, CachelineSize>::reset(T value) noexcept {
+    for(std::size_t i = 0; i <= mask; ++i)
+        slots[i].value.store(value, std::memory_order_relaxed);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Friday, 22nd April 2022 1:09:36 am
- * @modified   Sunday, 26th June 2022 3:41:37 pm
+ * @modified   Monday, 19th October 2026 11:52:08 am
  * @project    cpp-utils
  * @brief      Definitions of the synchronised_reference class template
  * 
@@ -63,7 +63,7 @@ public: /* ------------------------------------------- Public ctors, dtors & ope
     synchronised_reference &operator=(const synchronised_reference &rref) = delete;
     /// Move-constructible
     constexpr synchronised_reference(synchronised_reference &&rref);
-    /// Move-asignable
+    /// Move-asignable (unlocks the object referenced so far)
     constexpr synchronised_reference &operator=(synchronised_reference &&rref);
 
 public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Tuesday, 7th June 2022 6:49:43 pm
- * @modified   Sunday, 26th June 2022 3:41:37 pm
+ * @modified   Monday, 19th October 2026 11:52:08 am
  * @project    cpp-utils
  * @brief      
  * 
@@ -18,6 +18,7 @@
 
 // Standard includes
 #include <assert.h>
+#include <utility>
 // Private includes
 #include "estd/synchronised_reference.hpp"
 
@@ -53,9 +54,18 @@ constexpr synchronised_reference<T>::synchronised_reference(synchronised_referen
 
 template<typename T>
 constexpr synchronised_reference<T> &synchronised_reference<T>::operator=(synchronised_reference &&rref) {
-    obj        = rref.obj;
-    rref.moved = true;
-    rref.obj   = nullptr;
+
+    if(this != &rref) {
+
+        // Release the object held so far
+        if(not moved)
+            obj->unlock();
+
+        obj   = std::exchange(rref.obj, nullptr);
+        moved = std::exchange(rref.moved, true);
+    }
+
+    return *this;
 }
 
 /* ======================================================== Public methods ======================================================== */
@@ -0,0 +1,263 @@
+/* ============================================================================================================================ *//**
+ * @file       synchronized.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 11:52:08 am
+ * @modified   Monday, 19th October 2026 10:42:03 pm
+ * @project    cpp-utils
+ * @brief      Definition of the synchronized class template - value owned together with the lock guarding it
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_SYNCHRONIZED_H__
+#define __ESTD_SYNCHRONISATION_SYNCHRONIZED_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cassert>
+#include <concepts>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* =========================================================== Concepts =========================================================== */
+
+/**
+ * @brief Lock that can be held in the shared mode (std::shared_mutex, estd::rw_spin_lock)
+ */
+template<typename Lock>
+concept shared_lockable = requires(Lock &lock) {
+    lock.lock();
+    lock.unlock();
+    lock.lock_shared();
+    lock.unlock_shared();
+    { lock.try_lock_shared() } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief Shared lock whose shared ownership can be atomically converted into the exclusive one
+ *    (estd::rw_spin_lock)
+ */
+template<typename Lock>
+concept upgradable_lockable = shared_lockable<Lock> and requires(Lock &lock) {
+    { lock.try_unlock_shared_and_lock() } -> std::convertible_to<bool>;
+};
+
+/* ========================================================== locked_ptr ========================================================== */
+
+/**
+ * @brief Pointer-like proxy giving access to the value of the estd::synchronized for as long as it holds
+ *    the lock (the lock is released when the proxy is destroyed)
+ *
+ * @tparam Value
+ *    type of the accessed value (const-qualified for the shared access)
+ * @tparam Guard
+ *    type of the lock's guard (std::unique_lock or std::shared_lock)
+ */
+template<typename Value, typename Guard>
+class locked_ptr {
+
+    template<typename T, typename Lock>
+    friend class synchronized;
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /// Move-constructible
+    locked_ptr(locked_ptr &&other) noexcept = default;
+    /// Move-asignable
+    locked_ptr &operator=(locked_ptr &&other) noexcept = default;
+
+    /// @returns pointer to the value (the proxy is required not to be moved from)
+    Value *operator->() const noexcept { assert(guard.owns_lock()); return value; }
+
+    /// @returns reference to the value (the proxy is required not to be moved from)
+    Value &operator*() const noexcept { assert(guard.owns_lock()); return *value; }
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /// @returns pointer to the value (@c nullptr if the proxy has been moved from)
+    Value *get() const noexcept { return guard.owns_lock() ? value : nullptr; }
+
+private: /* -------------------------------------------------- Private methods ---------------------------------------------------- */
+
+    /// Constructs the proxy holding the @p guard
+    locked_ptr(Value &value, Guard &&guard) noexcept :
+        value{ &value },
+        guard{ std::move(guard) }
+    { }
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Accessed value
+    Value *value;
+
+    /// Guard holding the lock
+    Guard guard;
+
+};
+
+/* ========================================================= synchronized ========================================================= */
+
+/**
+ * @brief Wrapper owning the value together with the lock guarding it, so that the value cannot be
+ *    accessed without holding the lock. As opposed to the estd::synchronised_reference it does not
+ *    require the value itself to be lockable and distinguishes the exclusive (wlock()) and the shared
+ *    (rlock()) access, so read-heavy objects guarded with the shared lock are not serialized by readers.
+ *
+ *    @code
+ *
+ *    estd::synchronized<std::map<int, std::string>> names;
+ *
+ *    names.wlock()->emplace(1, "one");
+ *
+ *    if(auto reader = names.rlock(); not reader->contains(2)) {
+ *        auto writer = names.upgrade(std::move(reader));
+ *        writer->emplace(2, "two");
+ *    }
+ *
+ *    std::size_t count = names.with_rlock([](const auto &map) { return map.size(); });
+ *
+ *    @endcode
+ *
+ * @tparam T
+ *    type of the guarded value
+ * @tparam Lock
+ *    type of the lock; if it satisfies @ref shared_lockable rlock() takes it in the shared mode,
+ *    otherwise the exclusive one
+ */
+template<typename T, typename Lock = std::shared_mutex>
+class synchronized {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Type of the guarded value
+    using value_type = T;
+
+    /// Type of the lock
+    using lock_type = Lock;
+
+    /// Proxy giving the exclusive access to the value
+    using write_proxy = locked_ptr<T, std::unique_lock<Lock>>;
+
+    /// Proxy giving the shared access to the value
+    using read_proxy = locked_ptr<const T,
+        std::conditional_t<shared_lockable<Lock>, std::shared_lock<Lock>, std::unique_lock<Lock>>>;
+
+public: /* ------------------------------------------- Public ctors, dtors & operators -------------------------------------------- */
+
+    /**
+     * @brief Constructs value-initialized value
+     */
+    constexpr synchronized() requires std::is_default_constructible_v<T> = default;
+
+    /**
+     * @brief Constructs the value with copy of the @p value
+     */
+    constexpr explicit synchronized(const T &value) requires std::is_copy_constructible_v<T>;
+
+    /**
+     * @brief Constructs the value moving the @p value
+     */
+    constexpr explicit synchronized(T &&value) requires std::is_move_constructible_v<T>;
+
+    /**
+     * @brief Constructs the value in place from @p args
+     */
+    template<typename... Args>
+        requires std::is_constructible_v<T, Args&&...>
+    constexpr explicit synchronized(std::in_place_t, Args&&... args);
+
+    /// No copy-constructible
+    synchronized(const synchronized &other) = delete;
+    /// No copy-asignable
+    synchronized &operator=(const synchronized &other) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @returns
+     *    proxy holding the lock in the exclusive mode
+     */
+    inline write_proxy wlock();
+
+    /**
+     * @returns
+     *    proxy holding the lock in the shared mode (exclusive if the @ref lock_type is not
+     *    @ref shared_lockable)
+     */
+    inline read_proxy rlock() const;
+
+    /**
+     * @brief Calls @p function with the reference to the value while holding the lock in the exclusive mode
+     * @returns
+     *    result of the @p function
+     */
+    template<typename Function>
+        requires std::is_invocable_v<Function, T&>
+    inline decltype(auto) with_lock(Function &&function);
+
+    /**
+     * @brief Calls @p function with the const reference to the value while holding the lock in the shared mode
+     * @returns
+     *    result of the @p function
+     */
+    template<typename Function>
+        requires std::is_invocable_v<Function, const T&>
+    inline decltype(auto) with_rlock(Function &&function) const;
+
+    /**
+     * @brief Converts the shared access into the exclusive one. If the @ref lock_type is
+     *    @ref upgradable_lockable and the @p reader is the only reader, the conversion is atomic.
+     *    Otherwise the shared lock is released before the exclusive one is acquired, so the value may
+     *    have been modified by other writers in between and the condition the decision to write was
+     *    based on should be revalidated through the returned proxy
+     *
+     * @param reader
+     *    proxy holding the shared lock of this object
+     * @returns
+     *    proxy holding the lock in the exclusive mode
+     */
+    inline write_proxy upgrade(read_proxy &&reader);
+
+    /**
+     * @brief Tries to atomically convert the shared access into the exclusive one
+     *
+     * @param reader
+     *    proxy holding the shared lock of this object; left untouched on failure
+     * @returns
+     *    proxy holding the lock in the exclusive mode if the conversion succeeded (no writer could have
+     *    modified the value in between), @c std::nullopt otherwise
+     */
+    inline std::optional<write_proxy> try_upgrade(read_proxy &reader)
+        requires upgradable_lockable<Lock>;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Lock guarding the value
+    mutable Lock lock;
+
+    /// Guarded value
+    T value { };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "estd/synchronized/synchronized.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,128 @@
+/* ============================================================================================================================ *//**
+ * @file       synchronized.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 11:52:08 am
+ * @modified   Monday, 19th October 2026 11:52:08 am
+ * @project    cpp-utils
+ * @brief      Implementation of the synchronized class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ESTD_SYNCHRONISATION_SYNCHRONIZED_SYNCHRONIZED_H__
+#define __ESTD_SYNCHRONISATION_SYNCHRONIZED_SYNCHRONIZED_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cassert>
+#include <functional>
+// Private includes
+#include "estd/synchronized.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace estd {
+
+/* ================================================ Public ctors, dtors & operators =============================================== */
+
+template<typename T, typename Lock>
+constexpr synchronized<T, Lock>::synchronized(const T &value) requires std::is_copy_constructible_v<T> :
+    value{ value }
+{ }
+
+
+template<typename T, typename Lock>
+constexpr synchronized<T, Lock>::synchronized(T &&value) requires std::is_move_constructible_v<T> :
+    value{ std::move(value) }
+{ }
+
+
+template<typename T, typename Lock>
+template<typename... Args>
+    requires std::is_constructible_v<T, Args&&...>
+constexpr synchronized<T, Lock>::synchronized(std::in_place_t, Args&&... args) :
+    value( std::forward<Args>(args)... )
+{ }
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename T, typename Lock>
+typename synchronized<T, Lock>::write_proxy synchronized<T, Lock>::wlock() {
+    return write_proxy{ value, std::unique_lock<Lock>{ lock } };
+}
+
+
+template<typename T, typename Lock>
+typename synchronized<T, Lock>::read_proxy synchronized<T, Lock>::rlock() const {
+    if constexpr(shared_lockable<Lock>)
+        return read_proxy{ value, std::shared_lock<Lock>{ lock } };
+    else
+        return read_proxy{ value, std::unique_lock<Lock>{ lock } };
+}
+
+
+template<typename T, typename Lock>
+template<typename Function>
+    requires std::is_invocable_v<Function, T&>
+decltype(auto) synchronized<T, Lock>::with_lock(Function &&function) {
+    std::unique_lock guard{ lock };
+    return std::invoke(std::forward<Function>(function), value);
+}
+
+
+template<typename T, typename Lock>
+template<typename Function>
+    requires std::is_invocable_v<Function, const T&>
+decltype(auto) synchronized<T, Lock>::with_rlock(Function &&function) const {
+    auto reader = rlock();
+    return std::invoke(std::forward<Function>(function), *reader);
+}
+
+
+template<typename T, typename Lock>
+typename synchronized<T, Lock>::write_proxy synchronized<T, Lock>::upgrade(read_proxy &&reader) {
+
+    assert(reader.guard.mutex() == &lock and reader.guard.owns_lock());
+
+    // Reader of the non-shared lock already holds it exclusively
+    if constexpr(not shared_lockable<Lock>) {
+        reader.guard.release();
+        return write_proxy{ value, std::unique_lock<Lock>{ lock, std::adopt_lock } };
+    } else {
+
+        if constexpr(upgradable_lockable<Lock>) {
+            if(auto writer = try_upgrade(reader); writer.has_value())
+                return std::move(*writer);
+        }
+
+        reader.guard.unlock();
+
+        return wlock();
+    }
+}
+
+
+template<typename T, typename Lock>
+std::optional<typename synchronized<T, Lock>::write_proxy> synchronized<T, Lock>::try_upgrade(read_proxy &reader)
+    requires upgradable_lockable<Lock>
+{
+    assert(reader.guard.mutex() == &lock and reader.guard.owns_lock());
+
+    if(not lock.try_unlock_shared_and_lock())
+        return std::nullopt;
+
+    reader.guard.release();
+
+    return write_proxy{ value, std::unique_lock<Lock>{ lock, std::adopt_lock } };
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace estd
+
+/* ================================================================================================================================ */
+
+#endif
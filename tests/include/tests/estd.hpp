@@ -3,7 +3,7 @@
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Tuesday, 28th February 2023 8:38:54 pm
- * @modified   Tuesday, 28th February 2023 8:48:30 pm
+ * @modified   Monday, 19th October 2026 8:02:44 pm
  * @project    cpp-utils
  * @brief      
  * 
@@ -17,21 +17,49 @@
 /* =========================================================== Includes =========================================================== */
 
 // Compilation test for 'bits'
+#include "estd/atomic_named_bitset.hpp"
 #include "estd/bit.hpp"
+#include "estd/bit_stream.hpp"
+#include "estd/dynamic_bitset.hpp"
 #include "estd/named_bitset.hpp"
+#include "estd/packed_array.hpp"
+#include "estd/varint.hpp"
+// Functional test for 'bits'
+#include "tests/estd/atomic_named_bitset.hpp"
+#include "tests/estd/bit.hpp"
+#include "tests/estd/bit_stream.hpp"
+#include "tests/estd/dynamic_bitset.hpp"
+#include "tests/estd/named_bitset.hpp"
+#include "tests/estd/packed_array.hpp"
+#include "tests/estd/varint.hpp"
 // Compilation test for 'concepts'
 #include "estd/concepts.hpp"
 // Compilation test for 'enum'
 #include "estd/enum.hpp"
+#include "estd/enum_array.hpp"
+#include "estd/enum_map.hpp"
+#include "estd/enum_reflection.hpp"
+// Functional test for 'enum'
+#include "tests/estd/enum_containers.hpp"
+#include "tests/estd/enum_reflection.hpp"
 // Compilation test for 'miscellaneous'
 #include "estd/aligned_storage.hpp"
 #include "estd/callback.hpp"
+#include "estd/function_ref.hpp"
+#include "estd/inplace_callback.hpp"
 #include "estd/printf_format.hpp"
 #include "estd/robber.hpp"
+#include "estd/signal.hpp"
+#include "estd/static_dispatch_table.hpp"
 #include "estd/static_print.hpp"
 #include "estd/tag.hpp"
 #include "estd/type_name.hpp"
 #include "estd/typename.hpp"
+// Functional test for 'miscellaneous'
+#include "tests/estd/function_ref.hpp"
+#include "tests/estd/inplace_callback.hpp"
+#include "tests/estd/signal.hpp"
+#include "tests/estd/static_dispatch_table.hpp"
 // Compilation test for 'pointers'
 #include "estd/pointers.hpp"
 // Compilation test for 'preprocessor'
@@ -43,19 +71,65 @@
 #include "estd/preprocessor/va_opt_detect.hpp"
 #include "estd/preprocessor/variadic.hpp"
 #include "estd/preprocessor/cleanup.hpp"
+// Compilation test for 'reclaim'
+#include "estd/reclaim.hpp"
+// Functional test for 'reclaim'
+#include "tests/estd/reclaim.hpp"
 // Compilation test for 'result'
 #include "estd/result.hpp"
+// Functional test for 'result'
+#include "tests/estd/result.hpp"
+#include "tests/estd/status.hpp"
 // Compilation test for 'string'
 #include "estd/fixed_string.hpp"
+// Functional test for 'string'
+#include "tests/estd/fixed_string_parsing.hpp"
 // Compilation test for 'synchronisation'
 #include "estd/locks.hpp"
+#include "estd/profiled_lock.hpp"
+#include "estd/rcu_ptr.hpp"
+#include "estd/seqlock.hpp"
+#include "estd/sharded.hpp"
 #include "estd/synchronised_reference.hpp"
+#include "estd/synchronized.hpp"
+// Functional test for 'synchronisation'
+#include "tests/estd/locks.hpp"
+#include "tests/estd/profiled_lock.hpp"
+#include "tests/estd/rcu_ptr.hpp"
+#include "tests/estd/seqlock.hpp"
+#include "tests/estd/sharded.hpp"
+#include "tests/estd/synchronized.hpp"
 // Compilation test for 'traits'
 #include "estd/traits.hpp"
 
 /* ========================================================== Definitions ========================================================= */
 
-inline void estd_tests() { }
+inline void estd_tests()
+{
+    atomic_named_bitset_test();
+    bit_test();
+    bit_stream_test();
+    dynamic_bitset_test();
+    enum_containers_test();
+    enum_reflection_test();
+    fixed_string_parsing_test();
+    function_ref_test();
+    inplace_callback_test();
+    locks_test();
+    named_bitset_test();
+    packed_array_test();
+    profiled_lock_test();
+    rcu_ptr_test();
+    reclaim_test();
+    result_test();
+    seqlock_test();
+    sharded_test();
+    signal_test();
+    static_dispatch_table_test();
+    status_test();
+    synchronized_test();
+    varint_test();
+}
 
 /* ================================================================================================================================ */
 
@@ -0,0 +1,157 @@
+/* ============================================================================================================================ *//**
+ * @file       atomic_named_bitset.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 2:32:05 am
+ * @modified   Monday, 19th October 2026 6:14:52 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the atomic_named_bitset class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_ATOMIC_NAMED_BITSET_H__
+#define __TESTS_ESTD_ATOMIC_NAMED_BITSET_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <atomic>
+#include <thread>
+#include "boost/ut.hpp"
+#include "estd/atomic_named_bitset.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void atomic_named_bitset_test() {
+
+    "atomic_named_bitset"_test = [] {
+
+        enum class flag : unsigned { ready = 0, error = 3, busy = 7, overflow = 100 };
+
+        should("set, reset and test bits indexed with enum") = [] {
+
+            estd::atomic_named_bitset<128> flags;
+
+            expect(not flags.set(flag::ready));
+            expect(flags.set(flag::ready));
+            expect(not flags.set(flag::overflow));
+            expect(flags.test(flag::ready));
+            expect(flags.test(flag::overflow));
+            expect(not flags.test(flag::busy));
+            expect(flags.reset(flag::ready));
+            expect(not flags.test(flag::ready));
+            expect(not flags.flip(flag::busy));
+            expect(flags.test(flag::busy));
+        };
+
+        should("apply masks built with enum operators") = [] {
+
+            using estd::operator|;
+            using estd::operator~;
+
+            estd::atomic_named_bitset<8> flags;
+
+            expect(flags.fetch_or(flag::ready | flag::error) == 0U);
+            expect(flags.fetch_and(~flag::ready) == 0b1001U);
+            expect(flags.test(flag::error) and not flags.test(flag::ready));
+
+            auto snapshot = flags.snapshot();
+            expect(snapshot.test(flag::error));
+            expect(snapshot.count() == 1U);
+        };
+
+        should("convert from and to named_bitset") = [] {
+
+            estd::named_bitset<100> set;
+            set.set(flag::error);
+            set.set(99);
+
+            estd::atomic_named_bitset<100> flags{ set };
+            expect(flags.snapshot() == set);
+
+            estd::named_bitset<100> other;
+            other.set(70);
+            auto previous = flags.fetch_or(other);
+            expect(previous == set);
+            expect(flags.snapshot() == (set | other));
+
+            flags.clear();
+            expect(not flags.any());
+        };
+
+        should("give consistent snapshots to concurrent readers") = [] {
+
+            constexpr std::size_t N = 256;
+
+            estd::atomic_named_bitset<N> flags;
+            std::atomic<bool> done { false };
+
+            // Writer sets bits in ascending order and clears them in descending order, so each consistent snapshot holds a prefix of bits
+            std::thread writer([&] {
+                for(int round = 0; round < 200; ++round) {
+                    for(std::size_t i = 0; i < N; ++i)
+                        flags.set(i);
+                    for(std::size_t i = N; i > 0; --i)
+                        flags.reset(i - 1);
+                }
+                done = true;
+            });
+
+            bool consistent = true;
+            while(not done) {
+                auto snapshot = flags.snapshot();
+                std::size_t count = snapshot.count();
+                for(std::size_t i = 0; i < count; ++i)
+                    consistent = consistent and snapshot.test(i);
+            }
+
+            writer.join();
+
+            expect(consistent);
+        };
+
+        should("give consistent snapshots during whole-set writes") = [] {
+
+            constexpr std::size_t N = 4096;
+
+            estd::atomic_named_bitset<N> flags;
+            std::atomic<bool> done { false };
+
+            estd::named_bitset<N> ones;
+            ones.set();
+
+            // Each consistent snapshot holds either no bits or all of them
+            std::thread writer([&] {
+                for(int round = 0; round < 2000; ++round) {
+                    flags.store(ones);
+                    flags.clear();
+                    flags.fetch_or(ones);
+                    flags.fetch_and(estd::named_bitset<N>{ });
+                }
+                done = true;
+            });
+
+            bool consistent = true;
+            std::size_t snapshots = 0;
+            while(not done or snapshots == 0) {
+                std::size_t count = flags.snapshot().count();
+                consistent = consistent and (count == 0 or count == N);
+                ++snapshots;
+            }
+
+            writer.join();
+
+            expect(consistent);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,111 @@
+/* ============================================================================================================================ *//**
+ * @file       bit.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:48:02 pm
+ * @modified   Sunday, 18th October 2026 11:48:02 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the bit-aligned data utilities
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_BIT_H__
+#define __TESTS_ESTD_BIT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <random>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/bit.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void bit_test() {
+
+    "bit"_test = [] {
+
+        // Sizes of tested buffers (both sizes smaller than a single kernel's block and larger than a few blocks)
+        constexpr std::size_t sizes[] = { 0, 1, 7, 8, 9, 31, 32, 33, 63, 64, 65, 100, 1024, 4093, 1 << 20 };
+
+        // Generator of random test data
+        std::mt19937 generator{ 0x5EED };
+        auto random_buffer = [&](std::size_t size) {
+            std::vector<uint8_t> buffer(size);
+            for(auto &byte : buffer)
+                byte = uint8_t(generator());
+            return buffer;
+        };
+
+        should("shift bytes right like the byte-wise kernel") = [&] {
+            for(auto n : sizes) {
+                for(std::size_t shift = 1; shift < estd::byte_bitsize; ++shift) {
+
+                    auto src = random_buffer(n + 1);
+                    auto expected = random_buffer(n);
+                    auto actual = expected;
+
+                    estd::details::shift_bytes_right_bytewise(src.data(), expected.data(), n, shift);
+                    estd::details::shift_bytes_right(src.data(), actual.data(), n, shift);
+
+                    expect(expected == actual) << "n =" << n << "shift =" << shift;
+                }
+            }
+        };
+
+        should("shift bytes left like the byte-wise kernel") = [&] {
+            for(auto n : sizes) {
+                for(std::size_t shift = 1; shift < estd::byte_bitsize; ++shift) {
+
+                    auto src = random_buffer(n + 1);
+                    auto expected = random_buffer(n);
+                    auto actual = expected;
+
+                    estd::details::shift_bytes_left_bytewise(src.data() + 1, expected.data(), n, shift);
+                    estd::details::shift_bytes_left(src.data() + 1, actual.data(), n, shift);
+
+                    expect(expected == actual) << "n =" << n << "shift =" << shift;
+                }
+            }
+        };
+
+        should("copy bytes to and from bitshifted buffer") = [&] {
+            for(std::size_t i = 0; i < 1000; ++i) {
+
+                std::size_t n = generator() % 300;
+                std::size_t bitoffset = generator() % 40;
+
+                auto src = random_buffer(n);
+                auto shifted = random_buffer(n + 1 + bitoffset / estd::byte_bitsize);
+                auto original = shifted;
+                auto dst = random_buffer(n);
+
+                estd::copy_bytes_to_bitshifted(src.data(), shifted.data(), n, bitoffset);
+                estd::copy_bytes_from_bitshifted(shifted.data(), dst.data(), n, bitoffset);
+
+                // Data should survive the round trip
+                expect(src == dst) << "n =" << n << "bitoffset =" << bitoffset;
+
+                // Bits outside of the written range should stay untouched
+                for(std::size_t bit = 0; bit < shifted.size() * estd::byte_bitsize; ++bit) {
+                    if(bit < bitoffset or bit >= bitoffset + n * estd::byte_bitsize) {
+                        auto byte = bit / estd::byte_bitsize;
+                        auto mask = uint8_t(1U << (bit % estd::byte_bitsize));
+                        expect((shifted[byte] & mask) == (original[byte] & mask)) << "n =" << n << "bit =" << bit;
+                    }
+                }
+            }
+        };
+
+    };
+}
+
+/* ================================================================================================================================ */
+
+#endif
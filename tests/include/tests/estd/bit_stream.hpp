@@ -0,0 +1,208 @@
+/* ============================================================================================================================ *//**
+ * @file       bit_stream.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 12:21:40 am
+ * @modified   Monday, 19th October 2026 12:21:40 am
+ * @project    cpp-utils
+ * @brief      Unit test of the bitstream reader/writer
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_BIT_STREAM_H__
+#define __TESTS_ESTD_BIT_STREAM_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <array>
+#include <random>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/bit_stream.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================= Conditioning ========================================================= */
+
+namespace details {
+
+    /// Reference, bit-by-bit implementation of the stream read
+    template<estd::bit_order Order>
+    uint64_t read_bits_reference(const std::vector<uint8_t> &data, std::size_t offset, std::size_t nbits) {
+
+        uint64_t value = 0;
+
+        for(std::size_t i = 0; i < nbits; ++i) {
+
+            std::size_t pos = offset + i;
+            std::size_t bit = (Order == estd::bit_order::lsb_first) ? (pos % 8) : (7 - pos % 8);
+            uint64_t    val = (pos / 8 < data.size()) ? ((data[pos / 8] >> bit) & 1) : 0;
+
+            if constexpr (Order == estd::bit_order::lsb_first)
+                value |= (val << i);
+            else
+                value = (value << 1) | val;
+        }
+
+        return value;
+    }
+
+    /// Random test of the stream of given order
+    template<estd::bit_order Order>
+    void test_bit_stream_order(std::mt19937 &generator) {
+
+        should("read bits like the reference implementation") = [&] {
+            for(std::size_t size : { 0, 1, 7, 8, 9, 17, 64, 257 }) {
+
+                std::vector<uint8_t> data(size);
+                for(auto &byte : data)
+                    byte = uint8_t(generator());
+
+                estd::bit_reader<Order> reader{ data.data(), data.size() };
+
+                std::size_t offset = 0;
+                while(offset < size * 8 + 70) {
+
+                    std::size_t nbits = generator() % 65;
+
+                    expect(reader.read(nbits) == read_bits_reference<Order>(data, offset, nbits)) << "size =" << size << "offset =" << offset;
+                    offset += nbits;
+                    expect(reader.position() == offset);
+                    expect(reader.overrun() == (offset > size * 8));
+                }
+            }
+        };
+
+        should("read back written bits") = [&] {
+
+            std::vector<std::pair<uint64_t, std::size_t>> fields(1000);
+            std::size_t total = 0;
+
+            for(auto &[value, nbits] : fields) {
+                nbits  = generator() % 65;
+                value  = (uint64_t(generator()) << 32) | generator();
+                total += nbits;
+            }
+
+            std::vector<uint8_t> data((total + 7) / 8);
+            estd::bit_writer<Order> writer{ data.data(), data.size() };
+
+            for(auto &[value, nbits] : fields)
+                writer.write(value, nbits);
+
+            expect(writer.flush() == data.size());
+            expect(writer.position() == total);
+            expect(not writer.overrun());
+
+            estd::bit_reader<Order> reader{ data.data(), data.size() };
+
+            for(auto &[value, nbits] : fields) {
+                uint64_t mask = (nbits == 64) ? ~uint64_t(0) : ((uint64_t(1) << nbits) - 1);
+                expect(reader.read(nbits) == (value & mask));
+            }
+
+            expect(reader.bits_left() == data.size() * 8 - total);
+        };
+
+        should("skip and align") = [&] {
+
+            std::vector<uint8_t> data(64);
+            for(auto &byte : data)
+                byte = uint8_t(generator());
+
+            estd::bit_reader<Order> reader{ data.data(), data.size() };
+
+            reader.read(3);
+            reader.align();
+            expect(reader.position() == 8U);
+            expect(reader.template read<8>() == data[1]);
+            reader.skip(200);
+            expect(reader.position() == 216U);
+            expect(reader.template read<13>() == read_bits_reference<Order>(data, 216, 13));
+        };
+    }
+
+    /// Example frame for the layout test
+    enum class frame_kind : uint8_t { a = 1, b = 5 };
+    struct frame {
+        uint16_t   id;
+        bool       flag;
+        frame_kind kind;
+        int8_t     offset;
+        uint64_t   payload;
+    };
+
+    using frame_layout = estd::bit_layout<
+        estd::bit_field<uint16_t, 11>,
+        estd::bit_field<bool, 1>,
+        estd::bit_padding<2>,
+        estd::bit_field<frame_kind, 3>,
+        estd::bit_field<int8_t, 5>,
+        estd::bit_field<uint64_t, 64>
+    >;
+
+}
+
+inline void bit_stream_test() {
+
+    "bit_stream"_test = [] {
+
+        std::mt19937 generator{ 0x5EED };
+
+        details::test_bit_stream_order<estd::bit_order::lsb_first>(generator);
+        details::test_bit_stream_order<estd::bit_order::msb_first>(generator);
+
+        should("respect bit order") = [] {
+            constexpr uint8_t data[] = { 0xA5, 0x0F };
+            estd::bit_reader<estd::bit_order::lsb_first> lsb{ data, sizeof(data) };
+            estd::bit_reader<estd::bit_order::msb_first> msb{ data, sizeof(data) };
+            expect(lsb.read<4>() == 0x5U);
+            expect(msb.read<4>() == 0xAU);
+            expect(lsb.read<8>() == 0xFAU);
+            expect(msb.read<8>() == 0x50U);
+        };
+
+        should("decode and encode frame layout") = [] {
+
+            static_assert(details::frame_layout::bitsize == 86);
+            static_assert(details::frame_layout::size == 11);
+
+            details::frame input { 0x5A5, true, details::frame_kind::b, -7, 0x0123456789ABCDEF };
+
+            std::array<uint8_t, details::frame_layout::size> data { };
+            estd::bit_writer writer{ data.data(), data.size() };
+            details::frame_layout::encode(writer, { input.id, input.flag, input.kind, input.offset, input.payload });
+            expect(writer.flush() == data.size());
+
+            estd::bit_reader reader{ data.data(), data.size() };
+            auto output = details::frame_layout::decode_as<details::frame>(reader);
+
+            expect(output.id == input.id);
+            expect(output.flag == input.flag);
+            expect(output.kind == input.kind);
+            expect(output.offset == input.offset);
+            expect(output.payload == input.payload);
+            expect(not reader.overrun());
+        };
+
+        should("work at compile time") = [] {
+            constexpr auto value = [] {
+                constexpr uint8_t data[] = { 0xA5, 0x0F, 0x12 };
+                estd::bit_reader<estd::bit_order::msb_first> reader{ data, sizeof(data) };
+                auto [ high, low ] = estd::bit_layout<estd::bit_field<uint8_t, 4>, estd::bit_field<uint16_t, 12>>::decode(reader);
+                return (uint32_t(high) << 16) | low;
+            }();
+            static_assert(value == 0xA050F);
+            expect(value == 0xA050FU);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
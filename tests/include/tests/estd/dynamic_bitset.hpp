@@ -0,0 +1,194 @@
+/* ============================================================================================================================ *//**
+ * @file       dynamic_bitset.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 3:58:21 am
+ * @modified   Monday, 19th October 2026 3:58:21 am
+ * @project    cpp-utils
+ * @brief      Unit test of the dynamic_bitset class
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_DYNAMIC_BITSET_H__
+#define __TESTS_ESTD_DYNAMIC_BITSET_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <random>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/dynamic_bitset.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    /// Finds the first bit of the @p reference equal to @p value not lower than @p pos
+    inline std::size_t dynamic_bitset_find(const std::vector<bool> &reference, std::size_t pos, bool value) {
+
+        for(; pos < reference.size(); ++pos) {
+            if(reference[pos] == value)
+                return pos;
+        }
+
+        return estd::dynamic_bitset::npos;
+    }
+
+    /// Checks queries of the @p set against the @p reference at @p samples random positions
+    inline bool dynamic_bitset_matches(
+        const estd::dynamic_bitset &set,
+        const std::vector<bool> &reference,
+        std::mt19937 &generator,
+        std::size_t samples
+    ) {
+        std::size_t count = 0;
+        for(bool bit : reference)
+            count += bit;
+
+        bool result =
+            set.size()             == reference.size()                             and
+            set.count()            == count                                        and
+            set.any()              == (count != 0)                                 and
+            set.all()              == (count == reference.size())                  and
+            set.find_first_set()   == dynamic_bitset_find(reference, 0, true)      and
+            set.find_first_clear() == dynamic_bitset_find(reference, 0, false);
+
+        for(std::size_t i = 0; i < samples and not reference.empty(); ++i) {
+
+            std::size_t pos = generator() % reference.size();
+
+            std::size_t rank = 0;
+            for(std::size_t j = 0; j < pos; ++j)
+                rank += reference[j];
+
+            result = result                                                                 and
+                set.test(pos)            == reference[pos]                                  and
+                set.find_next_set(pos)   == dynamic_bitset_find(reference, pos + 1, true)   and
+                set.find_next_clear(pos) == dynamic_bitset_find(reference, pos + 1, false)  and
+                set.rank(pos)            == rank                                            and
+                (not reference[pos] or set.select(rank) == pos);
+        }
+
+        return result and set.select(count) == estd::dynamic_bitset::npos;
+    }
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void dynamic_bitset_test() {
+
+    "dynamic_bitset"_test = [] {
+
+        should("handle empty and uniform sets") = [] {
+
+            estd::dynamic_bitset empty;
+            expect(empty.none());
+            expect(empty.all());
+            expect(empty.find_first_set()   == estd::dynamic_bitset::npos);
+            expect(empty.find_first_clear() == estd::dynamic_bitset::npos);
+
+            estd::dynamic_bitset full(1000, true);
+            expect(full.count() == 1000U);
+            expect(full.all());
+            expect(full.find_first_clear() == estd::dynamic_bitset::npos);
+            expect(full.find_next_set(998) == 999U);
+            expect(full.find_next_set(999) == estd::dynamic_bitset::npos);
+
+            full.reset(500);
+            expect(full.find_first_clear() == 500U);
+            expect(full.rank(1000) == 999U);
+            expect(full.select(500) == 501U);
+        };
+
+        should("follow random modifications of sets of various sizes") = [] {
+
+            std::mt19937 generator{ 0x5EED };
+
+            // 300000 bits need three levels of summaries
+            for(std::size_t size : { 1U, 64U, 100U, 5000U, 300000U }) {
+
+                estd::dynamic_bitset set(size);
+                std::vector<bool>    reference(size);
+
+                for(std::size_t round = 0; round < 4; ++round) {
+
+                    // Sparse modifications in odd rounds, dense in even ones
+                    std::size_t modifications = (round % 2 == 0) ? size : 20;
+
+                    for(std::size_t i = 0; i < modifications; ++i) {
+
+                        std::size_t pos = generator() % size;
+
+                        switch(generator() % 3) {
+                            case 0:  set.set(pos);   reference[pos] = true;                break;
+                            case 1:  set.reset(pos); reference[pos] = false;               break;
+                            default: set.flip(pos);  reference[pos] = not reference[pos]; break;
+                        }
+                    }
+
+                    expect(details::dynamic_bitset_matches(set, reference, generator, 200));
+
+                    set.build_rank_index();
+                    expect(set.has_rank_index());
+                    expect(details::dynamic_bitset_matches(set, reference, generator, 200));
+                }
+            }
+        };
+
+        should("resize keeping the content") = [] {
+
+            estd::dynamic_bitset set(70);
+            set.set(3);
+            set.set(69);
+
+            set.resize(200, true);
+            expect(set.count() == 132U);
+            expect(set.find_first_clear() == 0U);
+            expect(set.find_next_clear(3) == 4U);
+            expect(set.find_next_clear(68) == estd::dynamic_bitset::npos);
+
+            set.resize(68);
+            expect(set.count() == 1U);
+            expect(set.find_next_set(3) == estd::dynamic_bitset::npos);
+
+            set.resize(130);
+            expect(set.count() == 1U);
+        };
+
+        should("allocate and release slots of a large pool") = [] {
+
+            constexpr std::size_t slots = 1'000'000;
+
+            // Set bits mark occupied slots
+            estd::dynamic_bitset pool(slots);
+
+            std::size_t misplaced = 0;
+            for(std::size_t i = 0; i < slots; ++i) {
+                std::size_t slot = pool.find_first_clear();
+                misplaced += (slot != i);
+                pool.set(slot);
+            }
+            expect(misplaced == 0U);
+            expect(pool.all());
+
+            // Released slots are reused in ascending order
+            pool.reset(777'777);
+            pool.reset(123);
+            expect(pool.find_first_clear() == 123U);
+            pool.set(123);
+            expect(pool.find_first_clear() == 777'777U);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
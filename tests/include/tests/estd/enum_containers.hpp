@@ -0,0 +1,199 @@
+/* ============================================================================================================================ *//**
+ * @file       enum_containers.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 5:20:37 am
+ * @modified   Monday, 19th October 2026 8:19:30 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the enum_array and enum_map class templates
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_ENUM_CONTAINERS_H__
+#define __TESTS_ESTD_ENUM_CONTAINERS_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/enum_array.hpp"
+#include "estd/enum_map.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    enum class container_state : int {
+        idle    = -1,
+        running =  0,
+        stopped =  2,
+    };
+
+    /// Element type counting its live instances and throwing on the copy after the given number of copies
+    struct container_element {
+
+        static inline int live   = 0;
+        static inline int copies = 0;
+
+        container_element() noexcept { ++live; }
+        container_element(const container_element&) {
+            if(copies-- == 0)
+                throw std::runtime_error{ "copy" };
+            ++live;
+        }
+        ~container_element() { --live; }
+    };
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void enum_containers_test() {
+
+    "enum_array"_test = [] {
+
+        using details::container_state;
+
+        should("index elements with enum range obtained by reflection") = [] {
+
+            constexpr auto array = [] {
+                estd::enum_array<container_state, int> result{ 7 };
+                result[container_state::stopped] = 3;
+                return result;
+            }();
+
+            static_assert(array.size() == 4);
+            static_assert(array[container_state::idle] == 7);
+            static_assert(array[container_state::stopped] == 3);
+            static_assert(estd::enum_array<container_state, int>::key(1) == container_state::running);
+            static_assert(not array.contains(static_cast<container_state>(3)));
+        };
+
+        should("iterate in enum order with explicit range") = [] {
+
+            estd::enum_array<container_state, int, container_state::running, container_state::stopped> array;
+            expect(array.size() == 3U);
+            expect(array.find(container_state::idle) == nullptr);
+
+            array[container_state::running] = 1;
+            array[container_state::stopped] = 2;
+
+            std::vector<int> keys, values;
+            array.for_each([&](container_state key, int value) {
+                keys.push_back(estd::to_underlying(key));
+                values.push_back(value);
+            });
+            expect(keys == std::vector<int>{ 0, 1, 2 });
+            expect(values == std::vector<int>(array.begin(), array.end()));
+        };
+    };
+
+    "enum_map"_test = [] {
+
+        using details::container_state;
+
+        should("insert, look up and erase elements") = [] {
+
+            estd::enum_map<container_state, std::string> map;
+            expect(map.empty());
+            expect(map.max_size() == 4U);
+
+            expect(map.emplace(container_state::stopped, "stopped").second);
+            expect(not map.emplace(container_state::stopped, "again").second);
+            expect(not map.insert_or_assign(container_state::stopped, "halted").second);
+            map[container_state::idle] = "idle";
+
+            expect(map.size() == 2U);
+            expect(map.contains(container_state::idle));
+            expect(not map.contains(container_state::running));
+            expect(not map.contains(static_cast<container_state>(7)));
+            expect(map.find(container_state::running) == nullptr);
+            expect(*map.find(container_state::stopped) == "halted");
+
+            expect(map.erase(container_state::idle) == 1U);
+            expect(map.erase(container_state::idle) == 0U);
+            expect(map.size() == 1U);
+        };
+
+        should("iterate over present elements in enum order") = [] {
+
+            estd::enum_map<container_state, int> map;
+            map[container_state::stopped] = 2;
+            map[container_state::idle]    = 0;
+
+            std::vector<container_state> keys;
+            for(auto [key, value] : map) {
+                keys.push_back(key);
+                value += 10;
+            }
+            expect(keys == std::vector{ container_state::idle, container_state::stopped });
+            expect(map[container_state::stopped] == 12);
+
+            const auto &view = map;
+            int sum = 0;
+            for(auto [key, value] : view)
+                sum += value;
+            expect(sum == 22);
+        };
+
+        should("manage lifetime of elements") = [] {
+
+            auto counter = std::make_shared<int>(0);
+
+            {
+                estd::enum_map<container_state, std::shared_ptr<int>> map;
+                map.emplace(container_state::idle, counter);
+                map.emplace(container_state::running, counter);
+
+                auto copy = map;
+                expect(counter.use_count() == 5);
+
+                auto moved = std::move(copy);
+                moved.clear();
+                expect(counter.use_count() == 3);
+            }
+
+            expect(counter.use_count() == 1);
+        };
+
+        should("destroy already copied elements when copy throws") = [] {
+
+            using details::container_element;
+
+            {
+                estd::enum_map<container_state, container_element> map;
+                map.emplace(container_state::idle);
+                map.emplace(container_state::running);
+                map.emplace(container_state::stopped);
+
+                // Fail on the third copy
+                container_element::copies = 2;
+                bool thrown = false;
+                try {
+                    auto copy = map;
+                } catch(const std::runtime_error&) {
+                    thrown = true;
+                }
+
+                expect(thrown);
+                expect(container_element::live == 3);
+            }
+
+            expect(container_element::live == 0);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,138 @@
+/* ============================================================================================================================ *//**
+ * @file       enum_reflection.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 4:41:09 am
+ * @modified   Monday, 19th October 2026 10:34:15 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the compile-time reflection of enumerations
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_ENUM_REFLECTION_H__
+#define __TESTS_ESTD_ENUM_REFLECTION_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <string>
+#include "boost/ut.hpp"
+#include "estd/enum_reflection.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    enum class reflected_color : int {
+        red           = 0,
+        green         = 5,
+        blue          = -3,
+        alpha_channel = 100,
+    };
+
+    enum class reflected_level : uint8_t {
+        trace,
+        debug,
+        info,
+        warning,
+        error,
+    };
+
+    enum class reflected_wide : int {
+        low  = 1000,
+        high = 1010,
+    };
+
+    enum reflected_unscoped : int {
+        reflected_one = 1,
+        reflected_two = 2,
+    };
+
+    namespace {
+
+        /// Enumeration with the scope printed as '(anonymous namespace)' by Clang
+        enum class reflected_hidden : int {
+            first  = 0,
+            second = 3,
+        };
+
+    }
+
+}
+
+/// Enumerators of reflected_wide lie outside of the default range
+template<>
+struct estd::enum_range<details::reflected_wide> {
+    static constexpr long long min = 1000;
+    static constexpr long long max = 1020;
+};
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void enum_reflection_test() {
+
+    "enum_reflection"_test = [] {
+
+        should("enumerate values and names at compile time") = [] {
+
+            using details::reflected_color;
+
+            static_assert(estd::enum_count<reflected_color> == 4);
+            static_assert(estd::enum_values<reflected_color>[0] == reflected_color::blue);
+            static_assert(estd::enum_values<reflected_color>[3] == reflected_color::alpha_channel);
+            static_assert(estd::enum_names<reflected_color>[0] == "blue");
+            static_assert(estd::enum_names<reflected_color>[3] == "alpha_channel");
+            static_assert(estd::enum_count<details::reflected_wide> == 2);
+        };
+
+        should("reflect enumerations declared in anonymous namespaces") = [] {
+
+            using details::reflected_hidden;
+
+            static_assert(estd::enum_count<reflected_hidden> == 2);
+            static_assert(estd::enum_names<reflected_hidden>[1] == "second");
+            static_assert(estd::to_string(reflected_hidden::first) == "first");
+            static_assert(estd::to_string(static_cast<reflected_hidden>(1)).empty());
+            static_assert(estd::from_string<reflected_hidden>("second") == reflected_hidden::second);
+        };
+
+        should("convert values to names") = [] {
+
+            using details::reflected_color;
+            using details::reflected_level;
+
+            static_assert(estd::to_string(reflected_color::green) == "green");
+            static_assert(estd::to_string(reflected_level::warning) == "warning");
+            static_assert(estd::to_string(details::reflected_two) == "reflected_two");
+            static_assert(estd::to_string(details::reflected_wide::high) == "high");
+            static_assert(estd::to_string(static_cast<reflected_color>(4)).empty());
+            static_assert(estd::to_string(static_cast<reflected_level>(200)).empty());
+
+            expect(estd::to_string(reflected_color::alpha_channel) == "alpha_channel");
+        };
+
+        should("convert names to values") = [] {
+
+            using details::reflected_color;
+            using details::reflected_level;
+
+            static_assert(estd::from_string<reflected_color>("red") == reflected_color::red);
+            static_assert(not estd::from_string<reflected_color>("alpha"));
+            static_assert(not estd::from_string<reflected_color>(""));
+
+            for(auto value : estd::enum_values<reflected_level>)
+                expect(estd::from_string<reflected_level>(std::string{ estd::to_string(value) }) == value);
+            expect(not estd::from_string<reflected_level>("Info").has_value());
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,241 @@
+/* ============================================================================================================================ *//**
+ * @file       fixed_string_parsing.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 8:02:44 pm
+ * @modified   Monday, 19th October 2026 9:41:09 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the compile-time tokenization and numbers parsing of the fixed strings
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_FIXED_STRING_PARSING_H__
+#define __TESTS_ESTD_FIXED_STRING_PARSING_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include "boost/ut.hpp"
+#include "estd/fixed_string.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    /// Parses @p text as integer of type @p T (rejections cannot be checked with the public API as they fail to compile)
+    template<typename T>
+    constexpr auto parse_integer(std::string_view text) {
+        return estd::details::parse_integer<T>(text);
+    }
+
+    /// Parses @p text as floating-point value of type @p T
+    template<typename T>
+    constexpr auto parse_floating(std::string_view text) {
+        return estd::details::parse_floating<T>(text);
+    }
+
+    /// Checks whether @p text is parsed to the same value (bit by bit) as with std::strtod() / std::strtof()
+    template<typename T>
+    bool parses_like_strtod(const std::string &text) {
+
+        using bits_type = std::conditional_t<std::is_same_v<T, float>, uint32_t, uint64_t>;
+
+        auto value    = estd::details::parse_floating<T>(std::string_view{ text });
+        T    expected = std::is_same_v<T, float> ? std::strtof(text.c_str(), nullptr) : std::strtod(text.c_str(), nullptr);
+
+        // Overflows are rejected
+        if(std::isinf(expected))
+            return not value.has_value();
+
+        return value.has_value() and std::bit_cast<bits_type>(*value) == std::bit_cast<bits_type>(expected);
+    }
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void fixed_string_parsing_test() {
+
+    "fixed_string_parsing"_test = [] {
+
+        should("trim and split strings") = [] {
+
+            constexpr auto trimmed = estd::trim<" \t value \n">();
+            static_assert(std::string_view{ trimmed } == "value");
+            static_assert(estd::trim<"   ">().size() == 0);
+
+            constexpr auto tokens = estd::split<"a,,b,", ','>();
+            static_assert(tokens.size() == 4);
+            static_assert(tokens[0] == "a" and tokens[1].empty() and tokens[2] == "b" and tokens[3].empty());
+
+            static_assert(estd::split<"", ','>().size() == 1);
+            static_assert(estd::split<"", ','>()[0].empty());
+            static_assert(estd::split<",", ','>().size() == 2);
+
+            expect(tokens[2] == std::string_view{ "b" });
+        };
+
+        should("parse integers in every base") = [] {
+
+            static_assert(estd::to_integer<int, "42">() == 42);
+            static_assert(estd::to_integer<int, " -42 ">() == -42);
+            static_assert(estd::to_integer<int, "+7">() == 7);
+            static_assert(estd::to_integer<unsigned, "0xFf">() == 255U);
+            static_assert(estd::to_integer<unsigned, "0X10">() == 16U);
+            static_assert(estd::to_integer<unsigned, "0o17">() == 15U);
+            static_assert(estd::to_integer<unsigned, "0b1011">() == 11U);
+            static_assert(estd::to_integer<int, "-0x80">() == -128);
+            static_assert(estd::to_integer<int, "0">() == 0);
+
+            // Digits of other bases and missing digits
+            static_assert(not details::parse_integer<int>("0b102").has_value());
+            static_assert(not details::parse_integer<int>("0o8").has_value());
+            static_assert(not details::parse_integer<int>("12a").has_value());
+            static_assert(not details::parse_integer<int>("0x").has_value());
+            static_assert(not details::parse_integer<int>("-").has_value());
+            static_assert(not details::parse_integer<int>("").has_value());
+            static_assert(not details::parse_integer<int>("1 2").has_value());
+
+            constexpr auto values = estd::split_to_integer<int, "1, 0x2 ,-3", ','>();
+            static_assert(values[0] == 1 and values[1] == 2 and values[2] == -3);
+
+            expect(values[2] == -3);
+        };
+
+        should("respect limits of signed and unsigned types") = [] {
+
+            static_assert(estd::to_integer<std::int8_t, "127">() == 127);
+            static_assert(estd::to_integer<std::int8_t, "-128">() == -128);
+            static_assert(not details::parse_integer<std::int8_t>("128").has_value());
+            static_assert(not details::parse_integer<std::int8_t>("-129").has_value());
+
+            static_assert(estd::to_integer<std::uint8_t, "255">() == 255);
+            static_assert(estd::to_integer<std::uint8_t, "-0">() == 0);
+            static_assert(not details::parse_integer<std::uint8_t>("256").has_value());
+            static_assert(not details::parse_integer<std::uint8_t>("-1").has_value());
+
+            static_assert(estd::to_integer<std::int64_t, "9223372036854775807">() == std::numeric_limits<std::int64_t>::max());
+            static_assert(estd::to_integer<std::int64_t, "-9223372036854775808">() == std::numeric_limits<std::int64_t>::min());
+            static_assert(not details::parse_integer<std::int64_t>("9223372036854775808").has_value());
+            static_assert(not details::parse_integer<std::int64_t>("-9223372036854775809").has_value());
+
+            static_assert(estd::to_integer<std::uint64_t, "0xFFFFFFFFFFFFFFFF">() == std::numeric_limits<std::uint64_t>::max());
+            static_assert(not details::parse_integer<std::uint64_t>("18446744073709551616").has_value());
+            static_assert(not details::parse_integer<std::uint64_t>("0x10000000000000000").has_value());
+
+            expect(estd::to_integer<std::int8_t, "-128">() == std::numeric_limits<std::int8_t>::min());
+        };
+
+        should("parse floating-point values") = [] {
+
+            static_assert(estd::to_floating<double, "1.5">() == 1.5);
+            static_assert(estd::to_floating<double, " -0.25 ">() == -0.25);
+            static_assert(estd::to_floating<double, "2.">() == 2.0);
+            static_assert(estd::to_floating<double, ".5">() == 0.5);
+            static_assert(estd::to_floating<double, "1e3">() == 1000.0);
+            static_assert(estd::to_floating<double, "125E-3">() == 0.125);
+            static_assert(estd::to_floating<double, "+4e+0">() == 4.0);
+            static_assert(estd::to_floating<double, "0e999999">() == 0.0);
+            static_assert(estd::to_floating<double, "1e-999999">() == 0.0);
+
+            // Long mantissas do not overflow the accumulator
+            static_assert(estd::to_floating<double, "123456789012345678901234567890">() > 1.2e29);
+
+            constexpr auto values = estd::split_to_floating<float, "0.5;-1;2e1", ';'>();
+            static_assert(values[0] == 0.5F and values[1] == -1.0F and values[2] == 20.0F);
+
+            expect(values[2] == 20.0F);
+        };
+
+        should("handle limits of floating-point types") = [] {
+
+            // Literals rounding down to the maximum are accepted
+            static_assert(estd::to_floating<float, "3.4028235e38">() == std::numeric_limits<float>::max());
+            static_assert(estd::to_floating<float, "-3.4028235e38">() == std::numeric_limits<float>::lowest());
+            static_assert(estd::to_floating<double, "1.7976931348623157e308">() == std::numeric_limits<double>::max());
+
+            // Literals rounding to the infinity are not
+            static_assert(not details::parse_floating<float>("3.5e38").has_value());
+            static_assert(not details::parse_floating<float>("1e39").has_value());
+            static_assert(not details::parse_floating<double>("1.8e308").has_value());
+            static_assert(not details::parse_floating<double>("1e999999").has_value());
+
+            expect(estd::to_floating<float, "3.4028235e38">() == std::numeric_limits<float>::max());
+        };
+
+        should("round floating-point values correctly") = [] {
+
+            static_assert(estd::to_floating<double, "7.3253680971e2">() == 7.3253680971e2);
+            static_assert(estd::to_floating<double, "5.38634e-5">() == 5.38634e-5);
+            static_assert(estd::to_floating<double, "0.1">() == 0.1);
+            static_assert(estd::to_floating<float, "0.1">() == 0.1F);
+
+            // Ties (2^53 + 1) are rounded to even, values above them are rounded up
+            static_assert(estd::to_floating<double, "9007199254740993">() == 9007199254740992.0);
+            static_assert(estd::to_floating<double, "9007199254740993.0000000000000000000000001">() == 9007199254740994.0);
+
+            // Subnormal values and halfway point below the minimal one
+            static_assert(estd::to_floating<double, "4.9406564584124654e-324">() == std::numeric_limits<double>::denorm_min());
+            static_assert(estd::to_floating<double, "2.4703282292062328e-324">() == std::numeric_limits<double>::denorm_min());
+            static_assert(estd::to_floating<double, "2.4703282292062327e-324">() == 0.0);
+            static_assert(estd::to_floating<double, "2.2250738585072011e-308">() == 2.2250738585072011e-308);
+
+            // Digits above the precision limit still decide about rounding
+            std::string tie = "9007199254740993." + std::string(1000, '0');
+            expect(details::parse_floating<double>(tie) == 9007199254740992.0);
+            expect(details::parse_floating<double>(tie + "1") == 9007199254740994.0);
+        };
+
+        should("parse random values like strtod") = [] {
+
+            std::mt19937_64 generator{ 26 };
+
+            for(int i = 0; i < 20'000; ++i) {
+
+                // Random mantissa with up to 20 digits and random position of the decimal point
+                std::string text;
+                for(auto digits = 1 + generator() % 20; digits > 0; --digits)
+                    text += char('0' + generator() % 10);
+                text.insert(generator() % (text.size() + 1), ".");
+                // Exponent covering subnormal values and overflows of double
+                text += "e" + std::to_string(long(generator() % 700) - 350);
+
+                expect(details::parses_like_strtod<double>(text)) << text;
+                expect(details::parses_like_strtod<float>(text)) << text;
+            }
+        };
+
+        should("reject malformed floating-point values") = [] {
+
+            static_assert(not details::parse_floating<double>("").has_value());
+            static_assert(not details::parse_floating<double>(".").has_value());
+            static_assert(not details::parse_floating<double>("-").has_value());
+            static_assert(not details::parse_floating<double>("1e").has_value());
+            static_assert(not details::parse_floating<double>("1e+").has_value());
+            static_assert(not details::parse_floating<double>("1.2.3").has_value());
+            static_assert(not details::parse_floating<double>("abc").has_value());
+            static_assert(not details::parse_floating<double>("1.5f").has_value());
+            static_assert(not details::parse_floating<double>("0x10").has_value());
+
+            expect(not details::parse_floating<double>("1 .5").has_value());
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,124 @@
+/* ============================================================================================================================ *//**
+ * @file       function_ref.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 6:47:52 am
+ * @modified   Monday, 19th October 2026 6:47:52 am
+ * @project    cpp-utils
+ * @brief      Unit test of the function_ref class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_FUNCTION_REF_H__
+#define __TESTS_ESTD_FUNCTION_REF_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include "boost/ut.hpp"
+#include "estd/function_ref.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    struct accumulator {
+
+        int add(int value) { return total += value; }
+        int get() const noexcept { return total; }
+
+        int total { 0 };
+    };
+
+    inline int multiply(int lhs, int rhs) { return lhs * rhs; }
+    inline int negate(int value) noexcept { return -value; }
+    inline int scaled(const accumulator &acc, int scale) { return acc.total * scale; }
+
+    inline int apply(estd::function_ref<int(int)> f, int value) { return f(value); }
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void function_ref_test() {
+
+    "function_ref"_test = [] {
+
+        should("be two words and trivially copyable") = [] {
+            static_assert(sizeof(estd::function_ref<void()>) == 2 * sizeof(void*));
+            static_assert(std::is_trivially_copyable_v<estd::function_ref<int(int) noexcept>>);
+        };
+
+        should("reference free functions") = [] {
+
+            estd::function_ref f = &details::multiply;
+            static_assert(std::is_same_v<decltype(f), estd::function_ref<int(int, int)>>);
+            expect(f(3, 4) == 12);
+
+            estd::function_ref<int(int) noexcept> g = details::negate;
+            expect(g(5) == -5);
+
+            int (*null_function)(int) = nullptr;
+            expect(estd::function_ref<int(int)>{ null_function } == nullptr);
+            expect(not estd::function_ref<void()>{ });
+        };
+
+        should("reference functors without copying them") = [] {
+
+            int calls = 0;
+            auto counter = [&calls](int value) mutable { ++calls; return value * 2; };
+
+            expect(details::apply(counter, 4) == 8);
+            expect(details::apply([](int value) { return value + 1; }, 4) == 5);
+            expect(calls == 1);
+
+            auto result = [](estd::function_ref<std::string(std::string)> f) { return f("abc"); }(
+                [](std::string value) { return value + "d"; }
+            );
+            expect(result == "abcd");
+
+            std::unique_ptr<int> owned;
+            auto store = [&owned](std::unique_ptr<int> value) { owned = std::move(value); };
+            estd::function_ref<void(std::unique_ptr<int>)> sink = store;
+            sink(std::make_unique<int>(3));
+            expect(owned != nullptr and *owned == 3);
+        };
+
+        should("bind functions known at compile time to objects") = [] {
+
+            details::accumulator acc;
+
+            estd::function_ref<int(int)> add{ estd::miscellaneous::vtag<&details::accumulator::add>{ }, acc };
+            add(2);
+            add(5);
+            expect(acc.total == 7);
+
+            estd::function_ref<int() noexcept> get{ estd::miscellaneous::vtag<&details::accumulator::get>{ }, acc };
+            expect(get() == 7);
+
+            estd::function_ref<int(int)> scale{ estd::miscellaneous::vtag<&details::scaled>{ }, acc };
+            expect(scale(2) == 14);
+
+            estd::function_ref<int(int, int)> unbound{ estd::miscellaneous::vtag<&details::multiply>{ } };
+            expect(unbound(6, 7) == 42);
+        };
+
+        should("reject throwing callables for noexcept signatures") = [] {
+            static_assert(not std::is_constructible_v<estd::function_ref<int(int) noexcept>, int(*)(int)>);
+            static_assert(std::is_constructible_v<estd::function_ref<int(int)>, int(*)(int) noexcept>);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,156 @@
+/* ============================================================================================================================ *//**
+ * @file       inplace_callback.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 6:02:14 am
+ * @modified   Monday, 19th October 2026 8:34:50 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the inplace_callback class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_INPLACE_CALLBACK_H__
+#define __TESTS_ESTD_INPLACE_CALLBACK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <array>
+#include <memory>
+#include <type_traits>
+#include "boost/ut.hpp"
+#include "estd/inplace_callback.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    /// Function object counting its live instances
+    struct counted_functor {
+
+        counted_functor(int &live) noexcept : live{ &live } { ++live; }
+        counted_functor(const counted_functor &other) noexcept : live{ other.live } { ++*live; }
+        counted_functor(counted_functor &&other) noexcept : live{ other.live } { ++*live; }
+        ~counted_functor() { --*live; }
+
+        int operator()(int value) const { return value + 1; }
+
+        int *live;
+    };
+
+    /// Copyable function object that may throw when moved
+    struct throwing_move_functor {
+
+        throwing_move_functor() = default;
+        throwing_move_functor(const throwing_move_functor&) = default;
+        throwing_move_functor(throwing_move_functor&&) noexcept(false) { }
+
+        int operator()(int value) const { return value; }
+    };
+
+    inline int add_two(int value) { return value + 2; }
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void inplace_callback_test() {
+
+    "inplace_callback"_test = [] {
+
+        should("store function objects bigger than the estd::callback") = [] {
+
+            std::array<int, 16> values{ };
+            values.back() = 5;
+
+            estd::inplace_callback<int(int), 128> callback = [values](int index) { return values[index]; };
+            static_assert(not decltype(callback)::can_store<std::array<int, 64>>);
+            expect(callback(15) == 5);
+
+            callback = &details::add_two;
+            expect(callback(1) == 3);
+        };
+
+        should("treat null function pointer as empty callback") = [] {
+
+            int (*function)(int) = nullptr;
+
+            estd::inplace_callback<int(int)> callback = function;
+            expect(not callback);
+            expect(callback == nullptr);
+        };
+
+        should("copy and destroy stored function objects") = [] {
+
+            int live = 0;
+
+            {
+                estd::inplace_callback<int(int), 16> callback = details::counted_functor{ live };
+                expect(live == 1);
+
+                auto copy = callback;
+                expect(live == 2);
+                expect(copy(1) == 2);
+
+                auto moved = std::move(copy);
+                expect(live == 2);
+                expect(not copy);
+
+                moved = nullptr;
+                expect(live == 1);
+            }
+
+            expect(live == 0);
+        };
+
+        should("reject function objects that may throw when moved") = [] {
+
+            using copyable_type  = estd::inplace_callback<int(int), 16, estd::callback_ops::copyable>;
+            using move_only_type = estd::inplace_callback<int(int), 16, estd::callback_ops::move_only>;
+
+            static_assert(not copyable_type::can_store<details::throwing_move_functor>);
+            static_assert(not move_only_type::can_store<details::throwing_move_functor>);
+            static_assert(copyable_type::can_store<details::counted_functor>);
+
+            expect(move_only_type::can_store<details::counted_functor>);
+        };
+
+        should("accept move-only function objects") = [] {
+
+            using callback_type = estd::inplace_callback<int(), 16, estd::callback_ops::move_only>;
+
+            static_assert(not std::is_copy_constructible_v<callback_type>);
+
+            callback_type callback = [value = std::make_unique<int>(7)] { return *value; };
+            callback_type other;
+            other.swap(callback);
+
+            expect(not callback);
+            expect(other() == 7);
+        };
+
+        should("be trivially copyable when restricted to trivial function objects") = [] {
+
+            using callback_type = estd::inplace_callback<int(int), 16, estd::callback_ops::trivial>;
+
+            static_assert(std::is_trivially_copyable_v<callback_type>);
+            static_assert(not callback_type::can_store<details::counted_functor>);
+
+            int offset = 3;
+            callback_type callback = [&offset](int value) { return value + offset; };
+            auto copy = callback;
+            offset = 4;
+            expect(copy(1) == 5);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,296 @@
+/* ============================================================================================================================ *//**
+ * @file       locks.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 8:51:05 am
+ * @modified   Monday, 19th October 2026 11:04:33 am
+ * @project    cpp-utils
+ * @brief      Unit test of the synchronisation locks
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_LOCKS_H__
+#define __TESTS_ESTD_LOCKS_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/locks.hpp"
+#include "estd/synchronised_reference.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    /**
+     * @brief Increments non-atomic counter guarded by the @p lock from @p threads threads
+     * @returns
+     *    @c true if no increment has been lost
+     */
+    template<typename Lock>
+    bool lock_excludes(Lock &lock, unsigned threads = 4, unsigned iterations = 20000) {
+
+        unsigned long counter = 0;
+
+        std::vector<std::thread> workers;
+        for(unsigned i = 0; i < threads; ++i) {
+            workers.emplace_back([&] {
+                for(unsigned j = 0; j < iterations; ++j) {
+                    std::lock_guard guard{ lock };
+                    ++counter;
+                }
+            });
+        }
+
+        for(auto &worker : workers)
+            worker.join();
+
+        return counter == static_cast<unsigned long>(threads) * iterations;
+    }
+
+    /**
+     * @brief Runs @p readers threads checking under the shared @p lock that two counters modified by
+     *    @p writers threads under the exclusive @p lock are always equal
+     * @returns
+     *    @c true if no reader has observed modification in progress and no modification has been lost
+     */
+    template<typename Lock>
+    bool shared_lock_excludes(Lock &lock, unsigned readers = 3, unsigned writers = 2, unsigned iterations = 5000) {
+
+        unsigned long first  = 0;
+        unsigned long second = 0;
+
+        std::atomic<unsigned> torn { 0 };
+
+        std::vector<std::thread> workers;
+        for(unsigned i = 0; i < writers; ++i) {
+            workers.emplace_back([&] {
+                for(unsigned j = 0; j < iterations; ++j) {
+                    std::lock_guard guard{ lock };
+                    ++first;
+                    ++second;
+                }
+            });
+        }
+        for(unsigned i = 0; i < readers; ++i) {
+            workers.emplace_back([&] {
+                for(unsigned j = 0; j < iterations; ++j) {
+                    std::shared_lock guard{ lock };
+                    if(first != second)
+                        torn.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for(auto &worker : workers)
+            worker.join();
+
+        return torn.load() == 0 and first == static_cast<unsigned long>(writers) * iterations;
+    }
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void locks_test() {
+
+    "spin_lock"_test = [] {
+
+        should("try to lock without waiting") = [] {
+
+            estd::spin_lock lock;
+
+            expect(lock.try_lock());
+            expect(not lock.try_lock());
+            lock.unlock();
+            expect(lock.try_lock());
+            lock.unlock();
+        };
+
+        should("exclude concurrent critical sections") = [] {
+
+            estd::spin_lock yielding;
+            expect(details::lock_excludes(yielding));
+
+            estd::spin_lock spinning{ estd::spin_wait::spin };
+            expect(details::lock_excludes(spinning, 2, 2000));
+        };
+    };
+
+    "ticket_lock"_test = [] {
+
+        should("try to lock without waiting") = [] {
+
+            estd::ticket_lock lock;
+
+            expect(lock.try_lock());
+            expect(not lock.try_lock());
+            lock.unlock();
+            expect(lock.try_lock());
+            lock.unlock();
+        };
+
+        should("exclude concurrent critical sections") = [] {
+            estd::ticket_lock lock;
+            expect(details::lock_excludes(lock));
+        };
+    };
+
+    "mcs_lock"_test = [] {
+
+        should("lock with caller-provided nodes") = [] {
+
+            estd::mcs_lock lock;
+            estd::mcs_lock::node first, second;
+
+            lock.lock(first);
+            expect(not lock.try_lock(second));
+            lock.unlock(first);
+            expect(lock.try_lock(second));
+            lock.unlock(second);
+        };
+
+        should("hold multiple locks with per-thread nodes") = [] {
+
+            estd::mcs_lock a, b, c;
+
+            std::lock_guard guard_a{ a };
+            b.lock();
+            expect(c.try_lock());
+            expect(not a.try_lock());
+
+            // Locks may be released in any order
+            b.unlock();
+            expect(b.try_lock());
+            c.unlock();
+            b.unlock();
+        };
+
+        should("exclude concurrent critical sections") = [] {
+            estd::mcs_lock lock;
+            expect(details::lock_excludes(lock));
+        };
+    };
+
+    "rw_spin_lock"_test = [] {
+
+        should("share the lock between readers only") = [] {
+
+            estd::rw_spin_lock lock;
+
+            expect(lock.try_lock_shared());
+            expect(lock.try_lock_shared());
+            expect(not lock.try_lock());
+            lock.unlock_shared();
+            lock.unlock_shared();
+
+            expect(lock.try_lock());
+            expect(not lock.try_lock_shared());
+            expect(not lock.try_lock());
+            lock.unlock();
+            expect(lock.try_lock_shared());
+            lock.unlock_shared();
+        };
+
+        should("hold back new readers while the writer waits") = [] {
+
+            estd::rw_spin_lock lock;
+            std::atomic<bool> written { false };
+
+            lock.lock_shared();
+
+            std::thread writer { [&] {
+                std::lock_guard guard{ lock };
+                written = true;
+            } };
+
+            // Wait until the writer announces itself
+            while(lock.try_lock_shared()) {
+                lock.unlock_shared();
+                std::this_thread::yield();
+            }
+
+            expect(not written.load());
+            lock.unlock_shared();
+            writer.join();
+
+            expect(written.load());
+            expect(lock.try_lock_shared());
+            lock.unlock_shared();
+        };
+
+        should("exclude writers from readers and each other") = [] {
+
+            estd::rw_spin_lock lock;
+            expect(details::lock_excludes(lock));
+            expect(details::shared_lock_excludes(lock));
+        };
+    };
+
+    "hybrid_mutex"_test = [] {
+
+        should("try to lock without waiting") = [] {
+
+            estd::hybrid_mutex lock;
+
+            expect(lock.try_lock());
+            expect(not lock.try_lock());
+            lock.unlock();
+            expect(lock.try_lock());
+            lock.unlock();
+        };
+
+        should("wake up waiters parked on the long critical section") = [] {
+
+            estd::hybrid_mutex lock;
+            std::atomic<int> acquired { 0 };
+
+            lock.lock();
+
+            std::vector<std::thread> waiters;
+            for(int i = 0; i < 3; ++i) {
+                waiters.emplace_back([&] {
+                    estd::synchronised_reference guard{ lock };
+                    acquired.fetch_add(1);
+                });
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            expect(acquired.load() == 0);
+
+            lock.unlock();
+            for(auto &waiter : waiters)
+                waiter.join();
+
+            expect(acquired.load() == 3);
+            expect(lock.try_lock());
+            lock.unlock();
+        };
+
+        should("exclude concurrent critical sections") = [] {
+
+            estd::hybrid_mutex adaptive;
+            expect(details::lock_excludes(adaptive));
+
+            estd::hybrid_mutex parking{ 0 };
+            expect(details::lock_excludes(parking));
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
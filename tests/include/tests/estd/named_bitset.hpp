@@ -0,0 +1,151 @@
+/* ============================================================================================================================ *//**
+ * @file       named_bitset.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 3:10:44 am
+ * @modified   Monday, 19th October 2026 8:47:05 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the named_bitset class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_NAMED_BITSET_H__
+#define __TESTS_ESTD_NAMED_BITSET_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <bit>
+#include <random>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/named_bitset.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    enum class named_bitset_flag : unsigned {
+        first  = 0,
+        second = 3,
+        last   = 9,
+    };
+
+    /// Checks scanning methods of the random set of @p N bits against per-bit tests
+    template<std::size_t N>
+    bool named_bitset_scan_matches(unsigned density) {
+
+        std::mt19937 generator{ static_cast<unsigned>(N) };
+
+        estd::named_bitset<N> set;
+        for(std::size_t i = 0; i < N; ++i)
+            set.set(i, generator() % 100 < density);
+
+        std::vector<std::size_t> expected;
+        for(std::size_t i = 0; i < N; ++i) {
+            if(set.test(i))
+                expected.push_back(i);
+        }
+
+        std::vector<std::size_t> visited;
+        set.for_each_set([&](std::size_t i) { visited.push_back(i); });
+
+        std::vector<std::size_t> iterated;
+        for(std::size_t i : set.set_bits())
+            iterated.push_back(i);
+
+        std::vector<std::size_t> found;
+        for(std::size_t i = set.find_first(); i < N; i = set.find_next(i))
+            found.push_back(i);
+
+        return
+            set.count() == expected.size()       and
+            set.any()   == (not expected.empty()) and
+            set.none()  == expected.empty()      and
+            visited  == expected                 and
+            iterated == expected                 and
+            found    == expected;
+    }
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void named_bitset_test() {
+
+    "named_bitset"_test = [] {
+
+        should("scan empty and full sets") = [] {
+
+            estd::named_bitset<1000> set;
+            expect(set.count() == 0U);
+            expect(set.none());
+            expect(set.find_first() == 1000U);
+
+            set.set();
+            expect(set.count() == 1000U);
+            expect(set.any());
+            expect(set.find_first() == 0U);
+            expect(set.find_next(998) == 999U);
+            expect(set.find_next(999) == 1000U);
+        };
+
+        should("scan random sets of various sizes") = [] {
+            for(unsigned density : { 1U, 30U, 90U }) {
+                expect(details::named_bitset_scan_matches<10>(density));
+                expect(details::named_bitset_scan_matches<64>(density));
+                expect(details::named_bitset_scan_matches<65>(density));
+                expect(details::named_bitset_scan_matches<507>(density));
+                expect(details::named_bitset_scan_matches<1000>(density));
+                expect(details::named_bitset_scan_matches<5000>(density));
+            }
+        };
+
+        should("ignore unused bits of the partially used last byte") = [] {
+
+            // Bits are read directly from the object representation only on little-endian targets
+            if constexpr (std::endian::native == std::endian::little) {
+
+                // Set of 64 bytes with 3 bits used in the last one
+                estd::named_bitset<507> set;
+                auto *bytes = reinterpret_cast<unsigned char*>(&set);
+
+                bytes[63] = 0xF8;
+                expect(set.count() == 0U);
+                expect(set.none());
+
+                bytes[63] = 0xFF;
+                expect(set.count() == 3U);
+                expect(set.any());
+            }
+        };
+
+        should("iterate over set bits as enumeration") = [] {
+
+            using flag = details::named_bitset_flag;
+
+            estd::named_bitset<10> set;
+            set.set(flag::second);
+            set.set(flag::last);
+
+            std::vector<flag> visited;
+            set.for_each_set<flag>([&](flag f) { visited.push_back(f); });
+            expect(visited == std::vector<flag>{ flag::second, flag::last });
+
+            std::vector<flag> iterated;
+            for(flag f : set.set_bits<flag>())
+                iterated.push_back(f);
+            expect(iterated == visited);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,136 @@
+/* ============================================================================================================================ *//**
+ * @file       packed_array.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:04:12 am
+ * @modified   Monday, 19th October 2026 1:04:12 am
+ * @project    cpp-utils
+ * @brief      Unit test of the bit-packed containers
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_PACKED_ARRAY_H__
+#define __TESTS_ESTD_PACKED_ARRAY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <random>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/packed_array.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================= Conditioning ========================================================= */
+
+namespace details {
+
+    /// Random test of the packed vector of the given width
+    template<std::size_t Bits>
+    void test_packed_vector(std::mt19937 &generator) {
+
+        using value_type = typename estd::packed_vector<Bits>::value_type;
+
+        constexpr uint64_t mask = (Bits == 64) ? ~uint64_t(0) : ((uint64_t(1) << Bits) - 1);
+
+        auto random_value = [&] {
+            return static_cast<value_type>(((uint64_t(generator()) << 32) | generator()) & mask);
+        };
+
+        constexpr std::size_t size = 1003;
+
+        // Fill packed and reference vectors with random values
+        estd::packed_vector<Bits> packed;
+        std::vector<value_type> reference;
+        for(std::size_t i = 0; i < size; ++i) {
+            reference.push_back(random_value());
+            packed.push_back(reference.back());
+        }
+
+        // Overwrite random elements
+        for(std::size_t i = 0; i < size; ++i) {
+            std::size_t index = generator() % size;
+            reference[index] = random_value();
+            packed[index] = reference[index];
+        }
+
+        bool equal = true;
+        for(std::size_t i = 0; i < size; ++i)
+            equal = equal and (packed[i] == reference[i]);
+        expect(equal) << "bits =" << Bits << ": get/set";
+
+        // Unpack and pack random ranges
+        for(int n = 0; n < 50; ++n) {
+
+            std::size_t first = generator() % size;
+            std::size_t count = generator() % (size - first + 1);
+
+            std::vector<value_type> unpacked(count);
+            packed.unpack(first, count, unpacked.data());
+            expect(std::equal(unpacked.begin(), unpacked.end(), reference.begin() + first)) << "bits =" << Bits << ": unpack";
+
+            for(auto &value : unpacked)
+                value = random_value();
+            std::copy(unpacked.begin(), unpacked.end(), reference.begin() + first);
+            packed.pack(first, count, unpacked.data());
+        }
+
+        equal = true;
+        for(std::size_t i = 0; i < size; ++i)
+            equal = equal and (packed.get(i) == reference[i]);
+        expect(equal) << "bits =" << Bits << ": pack";
+
+        // Shrink and grow again
+        packed.resize(size / 3);
+        packed.resize(size);
+        equal = true;
+        for(std::size_t i = 0; i < size; ++i)
+            equal = equal and (packed.get(i) == ((i < size / 3) ? reference[i] : 0));
+        expect(equal) << "bits =" << Bits << ": resize";
+    }
+
+}
+
+inline void packed_array_test() {
+
+    "packed_array"_test = [] {
+
+        std::mt19937 generator{ 0x5EED };
+
+        should("store values like a native vector") = [&] {
+            details::test_packed_vector<1>(generator);
+            details::test_packed_vector<5>(generator);
+            details::test_packed_vector<8>(generator);
+            details::test_packed_vector<12>(generator);
+            details::test_packed_vector<16>(generator);
+            details::test_packed_vector<25>(generator);
+            details::test_packed_vector<31>(generator);
+            details::test_packed_vector<33>(generator);
+            details::test_packed_vector<64>(generator);
+        };
+
+        should("pack fixed-size array into minimal storage") = [] {
+
+            constexpr auto array = [] {
+                estd::packed_array<12, 100> array;
+                for(std::size_t i = 0; i < array.size(); ++i)
+                    array[i] = static_cast<uint16_t>(i * 41);
+                return array;
+            }();
+
+            static_assert(sizeof(array) == (100 * 12 / 64 + 2) * sizeof(uint64_t));
+            static_assert(array.get(99) == (99 * 41) % 4096);
+
+            expect(array[50] == 50 * 41);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
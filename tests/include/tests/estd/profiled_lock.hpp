@@ -0,0 +1,154 @@
+/* ============================================================================================================================ *//**
+ * @file       profiled_lock.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 2:24:47 pm
+ * @modified   Monday, 19th October 2026 2:24:47 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the profiled_lock decorator
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_PROFILED_LOCK_H__
+#define __TESTS_ESTD_PROFILED_LOCK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/locks.hpp"
+#include "estd/profiled_lock.hpp"
+#include "estd/synchronised_reference.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void profiled_lock_test() {
+
+    "profiled_lock"_test = [] {
+
+        should("compile down to the decorated lock when disabled") = [] {
+
+            static_assert(sizeof(estd::profiled_lock<estd::spin_lock, "", false>) == sizeof(estd::spin_lock));
+
+            estd::profiled_lock<estd::spin_lock, "disabled", false> lock;
+
+            {
+                std::lock_guard guard{ lock };
+                expect(not lock.try_lock());
+            }
+
+            expect(lock.statistics().acquisitions == 0U);
+            expect(estd::lock_registry::global().statistics("disabled").acquisitions == 0U);
+        };
+
+        should("count acquisitions and measure hold time") = [] {
+
+            estd::profiled_lock<std::mutex, "", true> lock;
+
+            {
+                std::lock_guard guard{ lock };
+                std::this_thread::sleep_for(std::chrono::milliseconds{ 2 });
+            }
+
+            expect(lock.try_lock());
+            lock.unlock();
+
+            auto statistics = lock.statistics();
+            expect(statistics.acquisitions == 2U);
+            expect(statistics.contended_acquisitions == 0U);
+            expect(statistics.total_wait.count() == 0);
+            expect(statistics.max_hold >= std::chrono::milliseconds{ 2 });
+        };
+
+        should("record contended acquisitions") = [] {
+
+            estd::profiled_lock<estd::spin_lock, "", true> lock;
+
+            lock.lock();
+
+            std::thread other { [&lock] {
+                estd::synchronised_reference guard{ lock };
+            } };
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{ 5 });
+            lock.unlock();
+            other.join();
+
+            auto statistics = lock.statistics();
+            expect(statistics.acquisitions == 2U);
+            expect(statistics.contended_acquisitions == 1U);
+            expect(statistics.total_wait > std::chrono::nanoseconds{ 0 });
+        };
+
+        should("keep counters consistent under contention") = [] {
+
+            estd::profiled_lock<estd::spin_lock, "", true> lock;
+            long counter = 0;
+
+            std::vector<std::thread> workers;
+            for(int i = 0; i < 4; ++i) {
+                workers.emplace_back([&] {
+                    for(int j = 0; j < 10000; ++j) {
+                        std::lock_guard guard{ lock };
+                        ++counter;
+                    }
+                });
+            }
+
+            for(auto &worker : workers)
+                worker.join();
+
+            expect(counter == 40000);
+            expect(lock.statistics().acquisitions == 40000U);
+            expect(lock.statistics().contended_acquisitions <= 40000U);
+        };
+
+        should("report named locks in the registry") = [] {
+
+            auto &registry = estd::lock_registry::global();
+
+            {
+                estd::profiled_lock<estd::spin_lock, "test-queue", true> first;
+                estd::profiled_lock<std::mutex, "test-queue", true> second;
+                estd::profiled_lock<std::mutex, "test-pool", true> third;
+
+                for(int i = 0; i < 3; ++i) {
+                    std::lock_guard guard{ first };
+                }
+                {
+                    std::lock_guard guard{ second };
+                }
+
+                // Instances sharing the name are merged
+                expect(registry.statistics("test-queue").acquisitions == 4U);
+                expect(registry.statistics("test-pool").acquisitions == 0U);
+
+                std::ostringstream stream;
+                registry.dump(stream);
+
+                auto dump = stream.str();
+                expect(dump.find("test-queue: acquisitions=4 contended=0") != std::string::npos);
+                expect(dump.find("test-pool: acquisitions=0") != std::string::npos);
+                expect(dump.find("test-queue") == dump.rfind("test-queue"));
+            }
+
+            // Destroyed locks are unregistered
+            expect(registry.statistics("test-queue").acquisitions == 0U);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
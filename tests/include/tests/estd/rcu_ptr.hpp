@@ -0,0 +1,218 @@
+/* ============================================================================================================================ *//**
+ * @file       rcu_ptr.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 12:41:26 pm
+ * @modified   Monday, 19th October 2026 7:21:04 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the rcu_ptr class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_RCU_PTR_H__
+#define __TESTS_ESTD_RCU_PTR_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/rcu_ptr.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    /**
+     * @brief Configuration-like object counting its living instances
+     */
+    struct rcu_config {
+
+        rcu_config(long value, std::atomic<int> &instances) :
+            first{ value }, second{ value }, instances{ &instances }
+        {
+            instances.fetch_add(1);
+        }
+
+        rcu_config(const rcu_config &other) :
+            first{ other.first }, second{ other.second }, instances{ other.instances }
+        {
+            instances->fetch_add(1);
+        }
+
+        ~rcu_config() { instances->fetch_sub(1); }
+
+        long first;
+        long second;
+
+        std::atomic<int> *instances;
+    };
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void rcu_ptr_test() {
+
+    "rcu_ptr"_test = [] {
+
+        should("publish new objects to readers") = [] {
+
+            estd::rcu_ptr<int> value;
+            expect(not value.read());
+
+            value.emplace(1);
+            expect(*value.read() == 1);
+
+            value.update([](int &current) { current += 1; });
+            expect(*value.read() == 2);
+
+            {
+                auto writer = value.write();
+                *writer = 5;
+
+                // Copy is not visible until the guard is destroyed
+                expect(*value.read() == 2);
+            }
+            expect(*value.read() == 5);
+
+            value.store(nullptr);
+            expect(value.read().get() == nullptr);
+        };
+
+        should("discard copies modified by throwing writers") = [] {
+
+            std::atomic<int> instances { 0 };
+
+            estd::rcu_ptr<details::rcu_config> config{ std::make_unique<details::rcu_config>(1, instances) };
+
+            int thrown = 0;
+            try {
+                config.update([](details::rcu_config &current) { current.first = 2; throw 1; });
+            } catch(int) {
+                ++thrown;
+            }
+
+            try {
+                auto writer = config.write();
+                writer->first = 3;
+                throw 1;
+            } catch(int) {
+                ++thrown;
+            }
+
+            expect(thrown == 2);
+            expect(config.read()->first == 1);
+            expect(config.read()->second == 1);
+            expect(config.retired_count() == 0U);
+            expect(instances.load() == 1);
+
+            // Guards created while unwinding still publish
+            struct unwinder {
+                estd::rcu_ptr<details::rcu_config> &config;
+                ~unwinder() { config.update([](details::rcu_config &current) { current.first = current.second = 4; }); }
+            };
+
+            try {
+                unwinder publisher { config };
+                throw 1;
+            } catch(int) { }
+
+            expect(config.read()->first == 4);
+            expect(config.read()->second == 4);
+        };
+
+        should("keep retired objects alive for readers") = [] {
+
+            std::atomic<int> instances { 0 };
+
+            {
+                estd::rcu_ptr<details::rcu_config> config{ std::make_unique<details::rcu_config>(1, instances) };
+
+                {
+                    auto reader = config.read();
+                    auto nested = config.read();
+
+                    config.update([](details::rcu_config &current) { current.first = current.second = 2; });
+
+                    // Old object is still read
+                    expect(reader->first == 1);
+                    expect(config.retired_count() == 1U);
+                    expect(instances.load() == 2);
+
+                    // Readers entering after the update observe the new object
+                    std::thread other { [&] { expect(config.read()->first == 2); } };
+                    other.join();
+                }
+
+                config.synchronize();
+                expect(config.retired_count() == 0U);
+                expect(instances.load() == 1);
+
+                // Without readers objects are reclaimed on update
+                config.update([](details::rcu_config &current) { current.first = current.second = 3; });
+                expect(config.retired_count() == 0U);
+                expect(instances.load() == 1);
+            }
+
+            expect(instances.load() == 0);
+        };
+
+        should("give consistent objects to concurrent readers") = [] {
+
+            std::atomic<int> instances { 0 };
+            std::atomic<bool> stop { false };
+            std::atomic<unsigned> torn { 0 };
+
+            {
+                estd::rcu_ptr<details::rcu_config> config{ std::make_unique<details::rcu_config>(0, instances) };
+
+                std::vector<std::thread> readers;
+                for(int i = 0; i < 3; ++i) {
+                    readers.emplace_back([&] {
+                        while(not stop.load(std::memory_order_relaxed)) {
+                            auto reader = config.read();
+                            if(reader->first != reader->second)
+                                torn.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    });
+                }
+
+                std::vector<std::thread> writers;
+                for(int i = 0; i < 2; ++i) {
+                    writers.emplace_back([&] {
+                        for(int j = 0; j < 2000; ++j)
+                            config.update([](details::rcu_config &current) { current.first = current.second = current.first + 1; });
+                    });
+                }
+
+                for(auto &writer : writers)
+                    writer.join();
+                stop = true;
+                for(auto &reader : readers)
+                    reader.join();
+
+                expect(torn.load() == 0U);
+                expect(config.read()->first == 4000);
+
+                config.synchronize();
+                expect(instances.load() == 1);
+            }
+
+            expect(instances.load() == 0);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,237 @@
+/* ============================================================================================================================ *//**
+ * @file       reclaim.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:37:12 pm
+ * @modified   Monday, 19th October 2026 1:37:12 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the safe memory reclamation domains
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_RECLAIM_H__
+#define __TESTS_ESTD_RECLAIM_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/reclaim.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    /// Number of living reclaim_node objects
+    inline std::atomic<long> reclaim_nodes { 0 };
+
+    /**
+     * @brief Node counting its living instances
+     */
+    struct reclaim_node {
+
+        reclaim_node(long value) : value{ value }, copy{ value } { reclaim_nodes.fetch_add(1); }
+        ~reclaim_node() { reclaim_nodes.fetch_sub(1); }
+
+        long value;
+        long copy;
+
+        reclaim_node *next { nullptr };
+    };
+
+    /**
+     * @brief Lock-free (Treiber) stack reclaiming popped nodes with hazard pointers
+     */
+    class reclaim_stack {
+    public:
+
+        ~reclaim_stack() {
+            while(pop().has_value());
+        }
+
+        void push(long value) {
+            auto *node = new reclaim_node{ value };
+            node->next = head.load(std::memory_order_relaxed);
+            while(not head.compare_exchange_weak(node->next, node));
+        }
+
+        std::optional<long> pop() {
+
+            estd::reclaim::hazard_pointer hazard;
+
+            reclaim_node *top = hazard.protect(head);
+            while(top != nullptr and not head.compare_exchange_weak(top, top->next))
+                top = hazard.protect(head);
+
+            if(top == nullptr)
+                return std::nullopt;
+
+            long value = top->value;
+
+            hazard.reset();
+            estd::reclaim::hazard_domain::global().retire(top);
+
+            return value;
+        }
+
+    private:
+
+        std::atomic<reclaim_node*> head { nullptr };
+    };
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void reclaim_test() {
+
+    "hazard_pointer"_test = [] {
+
+        should("defer deletion of protected objects") = [] {
+
+            auto &domain = estd::reclaim::hazard_domain::global();
+            domain.reclaim();
+
+            long living = details::reclaim_nodes.load();
+
+            std::atomic<details::reclaim_node*> shared { new details::reclaim_node{ 1 } };
+
+            {
+                estd::reclaim::hazard_pointer hazard;
+                auto *node = hazard.protect(shared);
+                shared.store(nullptr);
+                domain.retire(node);
+
+                domain.reclaim();
+                expect(domain.pending() == 1U);
+                expect(node->value == 1);
+            }
+
+            domain.reclaim();
+            expect(domain.pending() == 0U);
+            expect(details::reclaim_nodes.load() == living);
+        };
+
+        should("keep lock-free stack consistent under concurrent pops") = [] {
+
+            long living = details::reclaim_nodes.load();
+
+            {
+                details::reclaim_stack stack;
+                std::atomic<long> popped { 0 };
+
+                std::vector<std::thread> workers;
+                for(int i = 0; i < 4; ++i) {
+                    workers.emplace_back([&, i] {
+                        for(long j = 0; j < 5000; ++j) {
+                            stack.push(i * 5000 + j);
+                            if(auto value = stack.pop(); value.has_value())
+                                popped.fetch_add(*value + 1, std::memory_order_relaxed);
+                        }
+                    });
+                }
+
+                for(auto &worker : workers)
+                    worker.join();
+
+                while(auto value = stack.pop())
+                    popped.fetch_add(*value + 1, std::memory_order_relaxed);
+
+                // Every pushed value has been popped exactly once
+                expect(popped.load() == 20000L * 20001L / 2);
+            }
+
+            estd::reclaim::hazard_domain::global().reclaim();
+            expect(details::reclaim_nodes.load() == living);
+        };
+    };
+
+    "epoch_domain"_test = [] {
+
+        should("defer deletion until critical sections end") = [] {
+
+            auto &domain = estd::reclaim::epoch_domain::global();
+            domain.synchronize();
+
+            long living = details::reclaim_nodes.load();
+
+            std::atomic<details::reclaim_node*> shared { new details::reclaim_node{ 1 } };
+
+            {
+                estd::reclaim::epoch_guard guard;
+                estd::reclaim::epoch_guard nested;
+
+                auto *node = guard.protect(shared);
+                domain.retire(shared.exchange(nullptr));
+
+                for(int i = 0; i < 4; ++i)
+                    domain.reclaim();
+
+                expect(domain.pending() == 1U);
+                expect(node->value == 1);
+            }
+
+            domain.synchronize();
+            expect(domain.pending() == 0U);
+            expect(details::reclaim_nodes.load() == living);
+        };
+
+        should("give live objects to concurrent readers") = [] {
+
+            auto &domain = estd::reclaim::epoch_domain::global();
+
+            long living = details::reclaim_nodes.load();
+
+            std::atomic<details::reclaim_node*> shared { new details::reclaim_node{ 0 } };
+            std::atomic<bool> stop { false };
+            std::atomic<unsigned> torn { 0 };
+
+            std::vector<std::thread> readers;
+            for(int i = 0; i < 3; ++i) {
+                readers.emplace_back([&] {
+                    while(not stop.load(std::memory_order_relaxed)) {
+                        estd::reclaim::epoch_guard guard;
+                        auto *node = guard.protect(shared);
+                        if(node->value != node->copy)
+                            torn.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+
+            std::vector<std::thread> writers;
+            for(int i = 0; i < 2; ++i) {
+                writers.emplace_back([&] {
+                    for(long j = 1; j <= 5000; ++j)
+                        estd::reclaim::epoch_domain::global().retire(shared.exchange(new details::reclaim_node{ j }));
+                    estd::reclaim::epoch_domain::global().synchronize();
+                });
+            }
+
+            for(auto &writer : writers)
+                writer.join();
+            stop = true;
+            for(auto &reader : readers)
+                reader.join();
+
+            expect(torn.load() == 0U);
+
+            domain.retire(shared.exchange(nullptr));
+            domain.synchronize();
+            expect(details::reclaim_nodes.load() == living);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,202 @@
+/* ============================================================================================================================ *//**
+ * @file       result.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 4:08:39 pm
+ * @modified   Monday, 19th October 2026 6:41:27 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the result class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_RESULT_H__
+#define __TESTS_ESTD_RESULT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include "boost/ut.hpp"
+#include "estd/result.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    /// Number of living result_tracked objects
+    inline int result_tracked_instances = 0;
+
+    /**
+     * @brief Value counting its living instances
+     */
+    struct result_tracked {
+
+        result_tracked(int value = 0) : value{ value } { ++result_tracked_instances; }
+        result_tracked(const result_tracked &other) : value{ other.value } { ++result_tracked_instances; }
+        result_tracked &operator=(const result_tracked &other) = default;
+        ~result_tracked() { --result_tracked_instances; }
+
+        int value;
+    };
+
+    /// Parses non-negative digit
+    inline estd::result<int> result_parse_digit(char c) {
+        if(c < '0' or c > '9')
+            return estd::result<int>::error(estd::DefaultDomain, estd::Error::Arg);
+        return c - '0';
+    }
+
+    /// Parses two-digit number using ESTD_TRY_ASSIGN
+    inline estd::result<int> result_parse_number(const char *text) {
+        ESTD_TRY_ASSIGN(int tens, result_parse_digit(text[0]));
+        ESTD_TRY_ASSIGN(int ones, result_parse_digit(text[1]));
+        return tens * 10 + ones;
+    }
+
+    /// Validates number using ESTD_TRY
+    inline estd::result<void> result_validate(const char *text) {
+        ESTD_TRY(result_parse_number(text));
+        return estd::result<void>::success();
+    }
+
+    /**
+     * @brief Value that is not default-constructible
+     */
+    struct result_explicit {
+
+        explicit result_explicit(int value) : value{ value } { }
+
+        int value;
+    };
+
+    /// Wraps the parsed number using ESTD_TRY_ASSIGN in the result of type that is not default-constructible
+    inline estd::result<result_explicit> result_parse_explicit(const char *text) {
+        ESTD_TRY_ASSIGN(int number, result_parse_number(text));
+        return result_explicit{ number };
+    }
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void result_test() {
+
+    "result"_test = [] {
+
+        should("be trivially copyable for trivially copyable values") = [] {
+
+            static_assert(std::is_trivially_copyable_v<estd::result<int>>);
+            static_assert(std::is_trivially_destructible_v<estd::result<int>>);
+            static_assert(std::is_trivially_copyable_v<estd::result<void>>);
+            static_assert(not std::is_trivially_copyable_v<estd::result<std::string>>);
+
+            constexpr auto value = estd::result<int>::success(5).map([](int v) { return v * 2; });
+            static_assert(value.value() == 10);
+        };
+
+        should("construct the value only for non-error results") = [] {
+
+            int instances = details::result_tracked_instances;
+
+            {
+                auto error = estd::result<details::result_tracked>::error();
+                expect(not error.has_value());
+                expect(details::result_tracked_instances == instances);
+
+                estd::result<details::result_tracked> value { details::result_tracked{ 3 } };
+                expect(value.has_value());
+                expect(details::result_tracked_instances == instances + 1);
+
+                // Assigning an error destroys the value
+                value = error;
+                expect(details::result_tracked_instances == instances);
+
+                value = details::result_tracked{ 4 };
+                expect(bool(value));
+                expect(value->value == 4);
+
+                auto copy = value;
+                expect(details::result_tracked_instances == instances + 2);
+            }
+
+            expect(details::result_tracked_instances == instances);
+        };
+
+        should("hold move-only values") = [] {
+
+            estd::result<std::unique_ptr<int>> pointer { std::make_unique<int>(7) };
+
+            auto moved = std::move(pointer);
+            expect(**moved == 7);
+
+            auto value = std::move(moved).map([](std::unique_ptr<int> &&p) { return *p + 1; });
+            expect(value == 8);
+        };
+
+        should("chain operations with monadic combinators") = [] {
+
+            auto twice = [](int v) { return estd::result<int>{ v * 2 }; };
+
+            expect(details::result_parse_digit('4').and_then(twice) == 8);
+            expect(not details::result_parse_digit('x').and_then(twice).has_value());
+            expect(details::result_parse_digit('x').and_then(twice) == estd::status::error(estd::DefaultDomain, estd::Error::Arg));
+
+            // Warning status is kept by map()
+            auto warning = estd::result<int>::warning(estd::DefaultDomain, estd::Warning::TooLate, 1).map([](int v) { return v + 1; });
+            expect(warning.has_value());
+            expect(not bool(warning));
+            expect(warning.value() == 2);
+
+            auto recovered = details::result_parse_digit('x').or_else([](const estd::status &) {
+                return estd::result<int>{ 0 };
+            });
+            expect(recovered == 0);
+            expect(details::result_parse_digit('x').value_or(-1) == -1);
+
+            auto text = details::result_parse_digit('1').map([](int v) { return std::to_string(v); });
+            expect(text.value() == "1");
+        };
+
+        should("require value of types that are not default-constructible") = [] {
+
+            using explicit_result = estd::result<details::result_explicit>;
+
+            static_assert(not std::is_constructible_v<explicit_result, estd::status>);
+            static_assert(not std::is_assignable_v<explicit_result&, estd::status>);
+            static_assert(std::is_nothrow_constructible_v<explicit_result, estd::failure>);
+            static_assert(std::is_nothrow_constructible_v<estd::result<int>, estd::status>);
+            static_assert(std::is_nothrow_assignable_v<estd::result<int>&, estd::status>);
+            static_assert(not std::is_nothrow_constructible_v<estd::result<details::result_tracked>, estd::status>);
+
+            expect(details::result_parse_explicit("42")->value == 42);
+            expect(not details::result_parse_explicit("x2").has_value());
+            expect(not explicit_result::error().has_value());
+
+            // Failures convert to statuses as well
+            estd::status status = estd::failure{ estd::status::error(estd::DefaultDomain, estd::Error::Arg) };
+            expect(status == estd::status::error(estd::DefaultDomain, estd::Error::Arg));
+        };
+
+        should("propagate errors with ESTD_TRY") = [] {
+
+            expect(details::result_parse_number("42") == 42);
+            expect(not details::result_parse_number("4x").has_value());
+            expect(not details::result_parse_number("x2").has_value());
+
+            expect(details::result_validate("42").has_value());
+            expect(details::result_validate("4x") == estd::status::error(estd::DefaultDomain, estd::Error::Arg));
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,141 @@
+/* ============================================================================================================================ *//**
+ * @file       seqlock.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 10:18:50 am
+ * @modified   Monday, 19th October 2026 7:05:38 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the seqlock class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_SEQLOCK_H__
+#define __TESTS_ESTD_SEQLOCK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/seqlock.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    struct seqlock_sample {
+
+        constexpr seqlock_sample(std::uint64_t value) :
+            value{ value }, doubled{ value * 2 }, tag{ static_cast<std::uint8_t>(value) }
+        { }
+
+        constexpr bool consistent() const { return doubled == value * 2 and tag == static_cast<std::uint8_t>(value); }
+
+        std::uint64_t value;
+        std::uint64_t doubled;
+        std::uint8_t  tag;
+    };
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void seqlock_test() {
+
+    "seqlock"_test = [] {
+
+        should("load the stored value") = [] {
+
+            estd::seqlock<int> lock;
+            expect(lock.load() == 0);
+
+            lock.store(7);
+            expect(lock.load() == 7);
+
+            int value = 0;
+            expect(lock.try_load(value));
+            expect(value == 7);
+
+            lock.update([](int &current) { current *= 3; });
+            expect(lock.load() == 21);
+        };
+
+        should("hold values that are not default-constructible") = [] {
+
+            estd::seqlock lock{ details::seqlock_sample{ 5 } };
+            expect(lock.load().consistent());
+            expect(lock.load().value == 5U);
+
+            lock.update([](details::seqlock_sample &sample) { sample = details::seqlock_sample{ sample.value + 1 }; });
+            expect(lock.load().value == 6U);
+        };
+
+        should("stay usable when update throws") = [] {
+
+            estd::seqlock<int> lock{ 3 };
+
+            bool thrown = false;
+            try {
+                lock.update([](int &current) { current = 100; throw 1; });
+            } catch(int) {
+                thrown = true;
+            }
+
+            expect(thrown);
+
+            int value = 0;
+            expect(lock.try_load(value));
+            expect(value == 3);
+
+            lock.update([](int &current) { ++current; });
+            expect(lock.load() == 4);
+        };
+
+        should("never return torn values to concurrent readers") = [] {
+
+            estd::seqlock lock{ details::seqlock_sample{ 0 } };
+            std::atomic<bool> stop { false };
+            std::atomic<unsigned> torn { 0 };
+
+            std::vector<std::thread> readers;
+            for(int i = 0; i < 3; ++i) {
+                readers.emplace_back([&] {
+                    while(not stop.load(std::memory_order_relaxed)) {
+                        if(not lock.load().consistent())
+                            torn.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+
+            std::vector<std::thread> writers;
+            for(int i = 0; i < 2; ++i) {
+                writers.emplace_back([&] {
+                    for(int j = 0; j < 5000; ++j)
+                        lock.update([](details::seqlock_sample &sample) { sample = details::seqlock_sample{ sample.value + 1 }; });
+                });
+            }
+
+            for(auto &writer : writers)
+                writer.join();
+            stop = true;
+            for(auto &reader : readers)
+                reader.join();
+
+            expect(torn.load() == 0U);
+            expect(lock.load().value == 10000U);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,107 @@
+/* ============================================================================================================================ *//**
+ * @file       sharded.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 3:16:05 pm
+ * @modified   Monday, 19th October 2026 3:16:05 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the sharded accumulators
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_SHARDED_H__
+#define __TESTS_ESTD_SHARDED_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/sharded.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void sharded_test() {
+
+    "sharded_counter"_test = [] {
+
+        should("round number of shards up to the power of 2") = [] {
+
+            expect(estd::sharded_counter{ 1 }.shards() == 1U);
+            expect(estd::sharded_counter{ 5 }.shards() == 8U);
+            expect(std::has_single_bit(estd::sharded_counter{ }.shards()));
+        };
+
+        should("sum increments of all threads") = [] {
+
+            estd::sharded_counter counter { 4 };
+            estd::basic_sharded_counter<estd::shard_policy::cpu> cpu_counter { 4 };
+
+            // More threads than shards, so some of them share a shard
+            std::vector<std::thread> workers;
+            for(int i = 0; i < 8; ++i) {
+                workers.emplace_back([&] {
+                    for(int j = 0; j < 10000; ++j) {
+                        ++counter;
+                        cpu_counter += 2;
+                    }
+                });
+            }
+
+            for(auto &worker : workers)
+                worker.join();
+
+            expect(counter.load() == 80000U);
+            expect(cpu_counter.load() == 160000U);
+
+            counter.reset();
+            expect(counter.load() == 0U);
+        };
+    };
+
+    "sharded"_test = [] {
+
+        should("fold shards with custom operations") = [] {
+
+            estd::sharded<std::int64_t> maximum { 0, 4 };
+
+            std::vector<std::thread> workers;
+            for(int i = 0; i < 4; ++i) {
+                workers.emplace_back([&, i] {
+                    for(std::int64_t j = 0; j < 1000; ++j)
+                        maximum.update([value = i * 1000 + j](std::int64_t current) { return std::max(current, value); });
+                });
+            }
+
+            for(auto &worker : workers)
+                worker.join();
+
+            expect(maximum.reduce(0, [](std::int64_t a, std::int64_t b) { return std::max(a, b); }) == 3999);
+        };
+
+        should("accumulate floating-point values") = [] {
+
+            estd::sharded<double> sum { 0.0, 2 };
+
+            sum.add(1.5);
+            sum.add(2.5);
+            expect(sum.load() == 4.0);
+
+            sum.reset();
+            expect(sum.load() == 0.0);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
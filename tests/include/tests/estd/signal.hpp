@@ -0,0 +1,145 @@
+/* ============================================================================================================================ *//**
+ * @file       signal.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 7:34:18 am
+ * @modified   Monday, 19th October 2026 7:34:18 am
+ * @project    cpp-utils
+ * @brief      Unit test of the signal class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_SIGNAL_H__
+#define __TESTS_ESTD_SIGNAL_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/signal.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    struct event_counter {
+
+        void on_event(int value) { total += value; }
+
+        int total { 0 };
+    };
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void signal_test() {
+
+    "signal"_test = [] {
+
+        should("call slots in the order of connection") = [] {
+
+            estd::signal<void(int)> signal;
+            std::vector<int> calls;
+
+            auto first  = signal.connect([&calls](int value) { calls.push_back(value); });
+            auto second = signal.connect([&calls](int value) { calls.push_back(value * 10); });
+
+            details::event_counter counter;
+            auto third = signal.connect(&counter, &details::event_counter::on_event);
+
+            expect(signal.size() == 3U);
+
+            signal(2);
+            expect(calls == std::vector{ 2, 20 });
+            expect(counter.total == 2);
+        };
+
+        should("disconnect slots with connection handles") = [] {
+
+            estd::signal<void()> signal;
+            int calls = 0;
+
+            {
+                auto connection = signal.connect([&calls] { ++calls; });
+                signal.emit();
+            }
+            signal.emit();
+            expect(calls == 1);
+            expect(signal.empty());
+
+            signal.connect([&calls] { ++calls; }).release();
+            auto connection = signal.connect([&calls] { calls += 10; });
+            signal.emit();
+            expect(calls == 12);
+
+            signal.disconnect_all();
+            connection.disconnect();
+            signal.emit();
+            expect(calls == 12);
+        };
+
+        should("let slots disconnect themselves while being called") = [] {
+
+            estd::signal<void()> signal;
+            estd::signal_connection connection;
+            int calls = 0;
+
+            connection = signal.connect([&] { ++calls; connection.disconnect(); });
+            auto other = signal.connect([&] { ++calls; });
+
+            signal.emit();
+            signal.emit();
+            expect(calls == 3);
+            expect(not connection.connected());
+        };
+
+        should("emit concurrently with connecting and disconnecting slots") = [] {
+
+            estd::signal<void(int)> signal;
+            std::atomic<long> total { 0 };
+            std::atomic<bool> stop { false };
+            std::atomic<int> running { 0 };
+
+            auto base = signal.connect([&total](int value) { total.fetch_add(value, std::memory_order_relaxed); });
+
+            std::vector<std::thread> emitters;
+            for(int i = 0; i < 4; ++i) {
+                emitters.emplace_back([&] {
+                    running.fetch_add(1);
+                    while(not stop.load(std::memory_order_relaxed))
+                        signal.emit(1);
+                });
+            }
+
+            while(running.load() != 4)
+                std::this_thread::yield();
+
+            for(int i = 0; i < 2000; ++i) {
+                auto connection = signal.connect([&total](int value) { total.fetch_add(value, std::memory_order_relaxed); });
+                if(i % 2 == 0)
+                    connection.disconnect();
+            }
+
+            stop = true;
+            for(auto &emitter : emitters)
+                emitter.join();
+
+            expect(total.load() > 0);
+            expect(signal.size() == 1U);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,141 @@
+/* ============================================================================================================================ *//**
+ * @file       static_dispatch_table.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 8:12:40 am
+ * @modified   Monday, 19th October 2026 10:21:46 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the static_dispatch_table class template
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_STATIC_DISPATCH_TABLE_H__
+#define __TESTS_ESTD_STATIC_DISPATCH_TABLE_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <type_traits>
+#include <utility>
+#include "boost/ut.hpp"
+#include "estd/static_dispatch_table.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    enum class packet_type : unsigned char {
+        ping  = 0,
+        data  = 1,
+        close = 2,
+    };
+
+    enum class packet_code : int {
+        invalid = -1,
+        ping    =  0,
+    };
+
+    struct packet_session {
+
+        int on_close(int code) { closed = true; return code; }
+
+        int  received { 0 };
+        bool closed   { false };
+    };
+
+    constexpr int on_ping(packet_session &, int value) { return value + 1; }
+    constexpr int on_data(packet_session &session, int value) { return session.received += value; }
+
+    template<int N>
+    constexpr int add(int value) { return value + N; }
+
+    template<std::size_t... I>
+    constexpr auto make_add_table(std::index_sequence<I...>) {
+        return estd::static_dispatch_table<&add<static_cast<int>(I)>...>{ };
+    }
+
+    using packet_handlers = estd::static_dispatch_table<
+        &on_ping,
+        &on_data,
+        &packet_session::on_close
+    >;
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void static_dispatch_table_test() {
+
+    "static_dispatch_table"_test = [] {
+
+        should("dispatch by index and enumerator") = [] {
+
+            details::packet_session session;
+
+            expect(details::packet_handlers::dispatch(0, session, 4) == 5);
+            expect(details::packet_handlers::dispatch(details::packet_type::data, session, 3) == 3);
+            expect(details::packet_handlers::dispatch(details::packet_type::data, session, 3) == 6);
+            expect(details::packet_handlers::dispatch(details::packet_type::close, session, 7) == 7);
+            expect(session.closed);
+        };
+
+        should("reject out-of-range indices with try_dispatch") = [] {
+
+            details::packet_session session;
+
+            expect(details::packet_handlers::try_dispatch(1, session, 2));
+            expect(not details::packet_handlers::try_dispatch(3, session, 2));
+            expect(session.received == 2);
+        };
+
+        should("reject out-of-range and negative enumerators with try_dispatch") = [] {
+
+            details::packet_session session;
+
+            expect(details::packet_handlers::try_dispatch(details::packet_type::data, session, 2));
+            expect(not details::packet_handlers::try_dispatch(static_cast<details::packet_type>(3), session, 2));
+            expect(not details::packet_handlers::try_dispatch(details::packet_code::invalid, session, 2));
+            expect(details::packet_handlers::try_dispatch(details::packet_code::ping, session, 2));
+            expect(session.received == 2);
+
+            static_assert(details::packet_handlers::contains(details::packet_code::ping));
+            static_assert(not details::packet_handlers::contains(details::packet_code::invalid));
+        };
+
+        should("dispatch at compile time with common result type") = [] {
+
+            using table = estd::static_dispatch_table<
+                [](int value) { return value * 2; },
+                [](int value) { return value * 0.5; }
+            >;
+
+            static_assert(std::is_same_v<table::result_t<int>, double>);
+            static_assert(table::size == 2);
+            static_assert(table::dispatch(0, 3) == 6.0);
+            static_assert(table::dispatch(1, 3) == 1.5);
+            static_assert(table::invoke<0>(4) == 8);
+        };
+
+        should("dispatch tables larger than a single switch") = [] {
+
+            using table = decltype(details::make_add_table(std::make_index_sequence<40>{ }));
+
+            int mismatches = 0;
+            for(std::size_t i = 0; i < table::size; ++i)
+                mismatches += (table::dispatch(i, 100) != 100 + static_cast<int>(i));
+
+            expect(mismatches == 0);
+            static_assert(table::dispatch(33, 0) == 33);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,151 @@
+/* ============================================================================================================================ *//**
+ * @file       status.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 5:02:13 pm
+ * @modified   Monday, 19th October 2026 8:58:21 pm
+ * @project    cpp-utils
+ * @brief      Unit test of the status class and the domains' registry
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_STATUS_H__
+#define __TESTS_ESTD_STATUS_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include "boost/ut.hpp"
+#include "estd/result.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    /// Error codes of the test domain
+    enum class status_test_error : uint32_t {
+        Broken,
+        Lost
+    };
+
+    /// Descriptor of the test domain
+    constexpr estd::domain_descriptor status_test_domain(
+        7,
+        estd::domain_descriptor::empty_table(),
+        estd::domain_descriptor::empty_table(),
+        (estd::domain_descriptor::description_table) { "Broken", "Lost" }
+    );
+
+    /// Descriptor of the test domain that is never registered
+    constexpr estd::domain_descriptor status_test_unregistered_domain(
+        8,
+        estd::domain_descriptor::empty_table(),
+        estd::domain_descriptor::empty_table(),
+        (estd::domain_descriptor::description_table) { "Unregistered" }
+    );
+
+    /// Checks whether the descriptor with the given @p index can be constructed at compile time
+    template<estd::domain_index index>
+    concept status_test_valid_index = requires {
+        typename std::integral_constant<estd::domain_index, estd::domain_descriptor(
+            index,
+            estd::domain_descriptor::empty_table(),
+            estd::domain_descriptor::empty_table(),
+            estd::domain_descriptor::empty_table()
+        ).getIndex()>;
+    };
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void status_test() {
+
+    "status"_test = [] {
+
+        should("fit into a single register") = [] {
+
+            static_assert(sizeof(estd::status) == sizeof(uint64_t));
+            static_assert(std::is_trivially_copyable_v<estd::status>);
+            static_assert(sizeof(estd::result<int>) == 2 * sizeof(uint64_t));
+
+            constexpr auto status = estd::status::error(estd::DefaultDomain, estd::Error::Busy);
+            static_assert(status.category() == estd::status_code::Category::Error);
+            static_assert(status.code() == uint32_t(estd::Error::Busy));
+            static_assert(status.domain() == estd::DefaultDomain);
+            expect(status.to_string() == std::string_view{ "Called context is busy and cannot serve a request" });
+        };
+
+        should("keep category and code across the whole range") = [] {
+
+            constexpr uint32_t max_code = (uint32_t(1) << 30) - 1;
+
+            auto status = estd::status::warning(estd::DefaultDomain, max_code);
+            expect(status.category() == estd::status_code::Category::Warning);
+            expect(status.code() == max_code);
+            expect(status.domain() == estd::DefaultDomain);
+            expect(static_cast<estd::status_code>(status) == estd::status_code::warning(max_code));
+
+            expect(bool(estd::status::success(3)));
+            expect(not bool(estd::status::warning(3)));
+            expect(estd::status::success(3) != estd::status::error(3));
+            expect(estd::status::error(estd::DefaultDomain, 3).code_enum<estd::Error>() == estd::Error::Nullptr);
+        };
+
+        should("map registered domains back to their descriptors") = [] {
+
+            expect(estd::register_domain(details::status_test_domain));
+            // Registering the same domain again is fine (taking the index of another domain is asserted)
+            expect(estd::register_domain(details::status_test_domain));
+
+            auto status = estd::status::error(details::status_test_domain.getDomainID(), details::status_test_error::Lost);
+            expect(status.domain() == details::status_test_domain.getDomainID());
+            expect(status.to_string() == std::string_view{ "Lost" });
+            expect(status != estd::status::error(estd::DefaultDomain, 1));
+
+            // Codes without description
+            expect(estd::status::success(details::status_test_domain.getDomainID(), 0).to_string().empty());
+            expect(estd::status::error(details::status_test_domain.getDomainID(), 2).to_string().empty());
+        };
+
+        should("describe statuses of unregistered domains as empty") = [] {
+
+            auto status = estd::status::error(details::status_test_unregistered_domain.getDomainID(), 0);
+            expect(status.domain() == nullptr);
+            expect(status.to_string().empty());
+            expect(status.code() == 0U);
+        };
+
+        should("reject indices of domains out of range at compile time") = [] {
+
+            static_assert(details::status_test_valid_index<estd::max_domains - 1>);
+            static_assert(not details::status_test_valid_index<estd::max_domains>);
+            static_assert(not details::status_test_valid_index<estd::NullDomainIndex>);
+
+            expect(estd::NullDomainIndex >= estd::max_domains);
+        };
+
+        should("accept statuses without domain") = [] {
+
+            auto status = estd::status::error(nullptr, 1);
+            expect(status.domain() == nullptr);
+            expect(status.to_string().empty());
+            expect(status.code() == 1U);
+            expect(status != estd::status::error(estd::DefaultDomain, 1));
+            expect(status == estd::status::error(nullptr, 1));
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
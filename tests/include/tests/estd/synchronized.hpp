@@ -0,0 +1,167 @@
+/* ============================================================================================================================ *//**
+ * @file       synchronized.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 11:52:08 am
+ * @modified   Monday, 19th October 2026 11:52:08 am
+ * @project    cpp-utils
+ * @brief      Unit test of the synchronized and synchronised_reference class templates
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_SYNCHRONIZED_H__
+#define __TESTS_ESTD_SYNCHRONIZED_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/locks.hpp"
+#include "estd/synchronised_reference.hpp"
+#include "estd/synchronized.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================== Auxiliary =========================================================== */
+
+namespace details {
+
+    struct synchronized_pair {
+        long first  { 0 };
+        long second { 0 };
+    };
+
+}
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void synchronized_test() {
+
+    "synchronized"_test = [] {
+
+        should("give access to the value through lock proxies") = [] {
+
+            estd::synchronized<std::map<int, std::string>> names;
+
+            names.wlock()->emplace(1, "one");
+            (*names.wlock())[2] = "two";
+
+            expect(names.rlock()->size() == 2U);
+            expect(names.rlock()->at(1) == "one");
+
+            std::size_t size = names.with_lock([](auto &map) { map.erase(1); return map.size(); });
+            expect(size == 1U);
+
+            expect(names.with_rlock([](const auto &map) { return map.contains(2); }));
+        };
+
+        should("support locks without the shared mode") = [] {
+
+            estd::synchronized<std::unique_ptr<int>, std::mutex> pointer{ std::in_place, new int{ 3 } };
+
+            **pointer.wlock() += 1;
+
+            auto reader = pointer.rlock();
+            expect(**reader == 4);
+
+            auto writer = pointer.upgrade(std::move(reader));
+            **writer = 5;
+            expect(reader.get() == nullptr);
+            expect(**writer == 5);
+        };
+
+        should("upgrade the shared access") = [] {
+
+            estd::synchronized<int, estd::rw_spin_lock> value{ 1 };
+
+            // The only reader is upgraded atomically
+            auto reader = value.rlock();
+            auto writer = value.try_upgrade(reader);
+            expect(writer.has_value());
+            expect(reader.get() == nullptr);
+            **writer = 2;
+            writer.reset();
+
+            // Upgrade is refused while other readers hold the lock
+            auto first  = value.rlock();
+            auto second = value.rlock();
+            expect(not value.try_upgrade(first).has_value());
+            expect(*first == 2);
+            second = std::move(first);
+
+            // Fallback upgrade of the std::shared_mutex
+            estd::synchronized<int> fallback{ 7 };
+            auto upgraded = fallback.upgrade(fallback.rlock());
+            *upgraded += 1;
+            expect(*upgraded == 8);
+        };
+
+        should("keep invariants for concurrent readers and writers") = [] {
+
+            estd::synchronized<details::synchronized_pair, estd::rw_spin_lock> pair;
+            std::atomic<unsigned> torn { 0 };
+
+            std::vector<std::thread> workers;
+            for(int i = 0; i < 2; ++i) {
+                workers.emplace_back([&] {
+                    for(int j = 0; j < 5000; ++j) {
+                        auto writer = pair.wlock();
+                        ++writer->first;
+                        ++writer->second;
+                    }
+                });
+            }
+            for(int i = 0; i < 2; ++i) {
+                workers.emplace_back([&] {
+                    for(int j = 0; j < 5000; ++j) {
+                        if(pair.with_rlock([](const auto &p) { return p.first != p.second; }))
+                            torn.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+
+            for(auto &worker : workers)
+                worker.join();
+
+            expect(torn.load() == 0U);
+            expect(pair.rlock()->first == 10000);
+        };
+    };
+
+    "synchronised_reference"_test = [] {
+
+        should("unlock the previous object on move-assignment") = [] {
+
+            estd::spin_lock a, b;
+
+            {
+                estd::synchronised_reference ra{ a };
+                estd::synchronised_reference rb{ b };
+
+                ra = std::move(rb);
+                expect(a.try_lock());
+                expect(not b.try_lock());
+                a.unlock();
+            }
+
+            expect(b.try_lock());
+            b.unlock();
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,111 @@
+/* ============================================================================================================================ *//**
+ * @file       varint.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Monday, 19th October 2026 1:47:30 am
+ * @modified   Monday, 19th October 2026 1:47:30 am
+ * @project    cpp-utils
+ * @brief      Unit test of the varint codec
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __TESTS_ESTD_VARINT_H__
+#define __TESTS_ESTD_VARINT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+#include "boost/ut.hpp"
+#include "estd/varint.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace boost::ut;
+
+/* ========================================================= Conditioning ========================================================= */
+
+inline void varint_test() {
+
+    "varint"_test = [] {
+
+        should("map signed values with zigzag") = [] {
+            static_assert(estd::zigzag_encode(int32_t(0))  == 0U);
+            static_assert(estd::zigzag_encode(int32_t(-1)) == 1U);
+            static_assert(estd::zigzag_encode(int32_t(1))  == 2U);
+            static_assert(estd::zigzag_encode(std::numeric_limits<int64_t>::min()) == std::numeric_limits<uint64_t>::max());
+            static_assert(estd::zigzag_decode(estd::zigzag_encode(int16_t(-12345))) == -12345);
+            static_assert(estd::zigzag_decode(std::numeric_limits<uint64_t>::max()) == std::numeric_limits<int64_t>::min());
+        };
+
+        should("encode and decode single values") = [] {
+
+            constexpr auto encoded = [] {
+                std::array<uint8_t, estd::varint_max_size> buffer { };
+                estd::encode_varint(300, buffer.data());
+                return buffer;
+            }();
+            static_assert(encoded[0] == 0xAC and encoded[1] == 0x02);
+
+            for(uint64_t value : { uint64_t(0), uint64_t(127), uint64_t(128), uint64_t(1) << 56, ~uint64_t(0) }) {
+                std::array<uint8_t, estd::varint_max_size> buffer { };
+                std::size_t size = estd::encode_varint(value, buffer.data());
+                uint64_t decoded;
+                expect(size == estd::varint_size(value));
+                expect(estd::decode_varint(buffer.data(), size, decoded) == size);
+                expect(decoded == value);
+                expect(estd::decode_varint(buffer.data(), size - 1, decoded) == 0U);
+            }
+
+            // Overlong varint
+            std::array<uint8_t, estd::varint_max_size> overlong;
+            overlong.fill(0xFF);
+            overlong.back() = 0x02;
+            uint64_t decoded;
+            expect(estd::decode_varint(overlong.data(), overlong.size(), decoded) == 0U);
+        };
+
+        should("encode and decode batches of mixed-length values") = [] {
+
+            std::mt19937_64 generator{ 0x5EED };
+
+            // Values of random lengths with long runs of single-byte values
+            std::vector<uint64_t> values(10000);
+            for(std::size_t i = 0; i < values.size(); ++i) {
+                std::size_t bits = ((i / 500) % 2 == 0) ? 7 : (generator() % 65);
+                values[i] = (bits == 64) ? generator() : (generator() & ((uint64_t(1) << bits) - 1));
+            }
+
+            std::vector<uint8_t> buffer(values.size() * estd::varint_max_size);
+            auto encoded = estd::encode_varints(values.data(), values.size(), buffer.data(), buffer.size());
+            expect(encoded.values == values.size());
+
+            // Batch encoding must be equal to the scalar one
+            std::vector<uint8_t> reference(buffer.size());
+            std::size_t reference_size = 0;
+            for(auto value : values)
+                reference_size += estd::encode_varint(value, reference.data() + reference_size);
+            expect(encoded.bytes == reference_size);
+            expect(std::equal(reference.begin(), reference.begin() + reference_size, buffer.begin()));
+
+            std::vector<uint64_t> decoded(values.size());
+            auto result = estd::decode_varints(buffer.data(), encoded.bytes, decoded.data(), decoded.size());
+            expect(result.values == values.size());
+            expect(result.bytes == encoded.bytes);
+            expect(decoded == values);
+
+            // Decoding stops at the truncated value
+            result = estd::decode_varints(buffer.data(), encoded.bytes - 1, decoded.data(), decoded.size());
+            expect(result.values == values.size() - 1);
+        };
+    };
+
+}
+
+/* ================================================================================================================================ */
+
+#endif